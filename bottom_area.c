@@ -2,8 +2,10 @@
 #include <curses.h>
 #include <panel.h>
 #include <string.h>
+#include <time.h>
 
 #include "bottom_area.h"
+#include "commons.h"
 #include "config.h"
 #include "file_operator.h"
 
@@ -44,7 +46,9 @@ static WINDOW *bottomBox;
 static PANEL *bottomPanel;
 static char msgBuf[MAX_BOTTOMBOX_MSG_LEN + 1];
 static int msgLen;
-static int msgLeftFrames;
+static bool isMsgShown;  // 메시지 출력 중인지
+static struct timespec msgShownTime;  // 메시지 출력 시작 시간 (Clock: CLOCK_MONOTONIC)
+static uint64_t msgShowUSec;  // 메시지 보여줄 시간
 
 
 WINDOW *initBottomBox(int width, int startY) {
@@ -90,21 +94,31 @@ bool checkAndResizeArea(int *newAreaWidth) {
     return true;
 }
 
-void displayBottomMsg(const char *msg, int framesToShow) {
+void displayBottomMsg(const char *msg, uint64_t usecToShow) {
     strncpy(msgBuf, msg, MAX_BOTTOMBOX_MSG_LEN);
     msgBuf[MAX_BOTTOMBOX_MSG_LEN] = '\0';
     msgLen = strlen(msgBuf);
-    msgLeftFrames = framesToShow;
+    clock_gettime(CLOCK_MONOTONIC, &msgShownTime);
+    msgShowUSec = usecToShow;
+    isMsgShown = true;
+}
+
+uint64_t getBottomMsgRemainingTime(void) {
+    if (!isMsgShown)
+        return 0;
+    uint64_t elapsedUSec = getElapsedTime(msgShownTime);
+    return elapsedUSec < msgShowUSec ? msgShowUSec - elapsedUSec : 0;
 }
 
 void clearBottomMsg() {
-    msgLeftFrames = 0;
+    isMsgShown = false;
 }
 
 void printHLineAndMsg(int winWidth) {
     mvwhline(bottomBox, 0, 0, ACS_HLINE, winWidth);
-    if (msgLeftFrames > 0) {
-        msgLeftFrames--;
+    if (isMsgShown && getBottomMsgRemainingTime() == 0)  // 시간 다 됨: 메시지 지움
+        isMsgShown = false;
+    if (isMsgShown) {
         int printWidth = msgLen;
         if (printWidth > winWidth - 6)
             printWidth = winWidth - 6;
@@ -124,7 +138,13 @@ void displayManual(int screenW) {
     const char *manual1, *manual2;
 
     // 창 크기에 따라 출력 내용 결정
-    if (screenW >= 125) {  // 전체 출력 7열
+    if (screenW >= 154) {  // 전체 출력 9열
+        manual1 = "[^ / v] Move     [^c / ^x] Copy / Cut   [F2] Rename         [Delete] Delete   [p] Process   [w] NameSort   [ e] SizeSort        [j] Jobs      [b] Stream";
+        manual2 = "[< / >] Switch   [  ^v   ] Paste        [^/] Move to Path   [Enter ] Open     [q] Quit      [r] DateSort   [^n] Create Folder   [o] Reflink";
+    } else if (screenW >= 141) {  // 8열
+        manual1 = "[^ / v] Move     [^c / ^x] Copy / Cut   [F2] Rename         [Delete] Delete   [p] Process   [w] NameSort   [ e] SizeSort        [j] Jobs";
+        manual2 = "[< / >] Switch   [  ^v   ] Paste        [^/] Move to Path   [Enter ] Open     [q] Quit      [r] DateSort   [^n] Create Folder   [o] Reflink";
+    } else if (screenW >= 125) {  // 7열
         manual1 = "[^ / v] Move     [^c / ^x] Copy / Cut   [F2] Rename         [Delete] Delete   [p] Process   [w] NameSort   [ e] SizeSort";
         manual2 = "[< / >] Switch   [  ^v   ] Paste        [^/] Move to Path   [Enter ] Open     [q] Quit      [r] DateSort   [^n] Create Folder";
     } else if (screenW >= 106) {  // 6열
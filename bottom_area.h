@@ -2,6 +2,7 @@
 #define _FOOTER_AREA_H_INCLUDED_
 
 #include <curses.h>
+#include <stdint.h>
 
 #include "file_operator.h"
 
@@ -33,9 +34,16 @@ void updateBottomBox(FileProgressInfo* infos);
  * 다음 updateBottomBox때부터 실제로 출력됨
  *
  * @param msg 출력할 (null-terminated) 문자열
- * @param framesToShow 보여줄 시간, Frame (=updateBottomBox 호출 횟수) 단위
+ * @param usecToShow 보여줄 시간 (단위: μs)
  */
-void displayBottomMsg(const char* msg, int framesToShow);
+void displayBottomMsg(const char* msg, uint64_t usecToShow);
+
+/**
+ * 출력 중인 메시지가 사라지기까지 남은 시간
+ *
+ * @return 남은 시간 (단위: μs), 메시지 없으면: 0
+ */
+uint64_t getBottomMsgRemainingTime(void);
 
 /**
  * 하단 영역에 출력된 메시지가 있으면, 지움
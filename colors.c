@@ -3,9 +3,13 @@
 #include <stdio.h>
 
 #include "colors.h"
+#include "config.h"
 
 bool isColorSafe = false;
 
+static short extraPairFg[MAX_EXTRA_COLOR_PAIRS];  // 추가된 Pair별 글자 색 (Index + PAIR_LAST = Pair 번호)
+static int totalExtraPairs;
+
 /**
  * 사용자 정의 색상을 RGB 값으로 초기화
  *
@@ -69,6 +73,21 @@ void initColors() {
     isColorSafe = true;  // 색 지원, 재정의 가능, 색 재정의 모두 성공
 }
 
+int addColorPair(short fg) {
+    if (!isColorSafe || fg < 0 || fg >= COLORS)
+        return DEFAULT;
+    for (int i = 0; i < totalExtraPairs; i++) {  // 이미 추가된 색
+        if (extraPairFg[i] == fg)
+            return PAIR_LAST + i;
+    }
+    if (totalExtraPairs >= MAX_EXTRA_COLOR_PAIRS || PAIR_LAST + totalExtraPairs >= COLOR_PAIRS)
+        return DEFAULT;
+    if (init_pair(PAIR_LAST + totalExtraPairs, fg, COLOR_ORANGE) == ERR)  // 배경: 폴더 창 배경과 같게
+        return DEFAULT;
+    extraPairFg[totalExtraPairs] = fg;
+    return PAIR_LAST + totalExtraPairs++;
+}
+
 // 색상 적용
 void applyColor(WINDOW *win, int colorPair) {
     if (isColorSafe)
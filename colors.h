@@ -42,6 +42,18 @@ extern bool isColorSafe;
  */
 void initColors(void);
 
+/**
+ * 폴더 창 배경 위에 쓸 색상 Pair 추가 (LS_COLORS 등)
+ *
+ * @param fg 글자 색 (ncurses 색 번호)
+ * @return 성공: 추가된 (or 이미 있던) 색상 Pair 번호, 실패: DEFAULT (색 미지원, Pair 수 초과)
+ *
+ * @details
+ * - 같은 글자 색에 대해 여러 번 호출: 같은 Pair 반환
+ * - initColors() 이후에만 호출 가능
+ */
+int addColorPair(short fg);
+
 /**
  * 창에 색상을 적용
  *
@@ -19,8 +19,19 @@ uint64_t getElapsedTime(struct timespec baseTime) {
     return elapsedTime;
 }
 
+uint64_t getMonotonicUSec(void) {
+    struct timespec currentTime;
+    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+    return (uint64_t)currentTime.tv_sec * 1000 * 1000 + currentTime.tv_nsec / 1000 + 1;  // +1: 부팅 직후에도 0 아님
+}
+
 char *formatSize(size_t size) {
     static char formatted_size[16];
+    formatSizeBuf(size, formatted_size, sizeof(formatted_size));
+    return formatted_size;
+}
+
+void formatSizeBuf(uint64_t size, char *buf, size_t bufSize) {
     const char *units[] = { "B", "KB", "MB", "GB", "TB" };
     int unit_index = 0;
 
@@ -28,7 +39,16 @@ char *formatSize(size_t size) {
         size >>= 10;  // 성능을 위해 비트 시프트로 연산, 2^10을 나누는 나눔
         unit_index++;
     }
-    // 사이즈 형식으로 포매팅해서 스트링 리턴
-    snprintf(formatted_size, sizeof(formatted_size), "%lu%s", size, units[unit_index]);
-    return formatted_size;
+    // 사이즈 형식으로 포매팅
+    snprintf(buf, bufSize, "%lu%s", (unsigned long)size, units[unit_index]);
+}
+
+void formatUSec(uint64_t usec, char *buf, size_t bufSize) {
+    if (usec < 1000) {
+        snprintf(buf, bufSize, "%uus", (unsigned int)usec);
+    } else if (usec < 1000 * 1000) {
+        snprintf(buf, bufSize, "%.1fms", usec / 1000.0);
+    } else {
+        snprintf(buf, bufSize, "%.2fs", usec / (1000.0 * 1000.0));
+    }
 }
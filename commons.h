@@ -54,6 +54,13 @@
  */
 uint64_t getElapsedTime(struct timespec baseTime);
 
+/**
+ * 현재 시간 (Clock: CLOCK_MONOTONIC 기준)
+ *
+ * @return 현재 시간 (단위: μs, 0이 아님: 0은 '시간 없음' 용도로 사용 가능)
+ */
+uint64_t getMonotonicUSec(void);
+
 /**
  * 크기를 1G, 500M 등의 형식으로 변환
  *
@@ -62,4 +69,22 @@ uint64_t getElapsedTime(struct timespec baseTime);
  */
 char *formatSize(size_t size);
 
+/**
+ * 크기를 1G, 500M 등의 형식으로 변환 (호출한 쪽의 Buffer 사용: 여러 번 호출해 함께 출력 가능, Thread 안전)
+ *
+ * @param size 변환하고자 하는 크기
+ * @param buf (반환) 변환된 문자열
+ * @param bufSize buf 크기 (16 bytes 이상 권장: 넘치면 잘림)
+ */
+void formatSizeBuf(uint64_t size, char *buf, size_t bufSize);
+
+/**
+ * 시간을 짧은 문자열로 변환 (예: "850us", "12.3ms", "1.20s")
+ *
+ * @param usec 시간 [단위: μs]
+ * @param buf (반환) 변환된 문자열
+ * @param bufSize buf 크기 (16 bytes 이상 권장: 넘치면 잘림)
+ */
+void formatUSec(uint64_t usec, char *buf, size_t bufSize);
+
 #endif
@@ -8,9 +8,20 @@
 #define PROG_NAME_LEN (sizeof(PROG_NAME) - 1)
 
 // Delay들
-#define FRAME_INTERVAL_USEC (50 * 1000)  // Framerate 제한 (단위: μs)
-#define FRAME_PER_SECOND ((1000 * 1000) / FRAME_INTERVAL_USEC)  // 1초당 프레임 수
-#define DIR_INTERVAL_USEC (1 * 1000 * 1000)  // 폴더 정보 새로고침 간격 (단위: μs)
+#define MAX_INPUT_FPS 120  // 키 입력 (Auto-repeat 등) 중 최대 화면 갱신 횟수 (초당): 그 사이 입력된 키는 모아서 한 Frame에 반영
+#define INPUT_FRAME_INTERVAL_USEC ((1000 * 1000) / MAX_INPUT_FPS)  // 키 입력으로 인한 화면 갱신 최소 간격 (단위: μs)
+#define FRAME_INTERVAL_USEC (50 * 1000)  // Thread의 새 결과 알림으로 인한 화면 갱신 최소 간격 (단위: μs)
+#define PROGRESS_FRAME_INTERVAL_USEC (250 * 1000)  // 진행률만 바뀐 경우 화면 갱신 최소 간격 (단위: μs)
+#define BOTTOM_MSG_USEC (1 * 1000 * 1000)  // 하단 메시지 표시 시간 (단위: μs)
+#define DIR_INTERVAL_USEC (1 * 1000 * 1000)  // 폴더 정보 새로고침 간격: 선택된 창 (단위: μs)
+#define DIR_UNFOCUSED_INTERVAL_USEC (4 * 1000 * 1000)  // 폴더 정보 새로고침 간격: 선택되지 않은 창 (단위: μs) (숨겨진 창: 새로고침 X)
+#define DIR_MAX_INTERVAL_USEC (30 * 1000 * 1000)  // 폴더 정보 새로고침 간격 최댓값 (Backoff 상한) (단위: μs)
+#define DIR_BACKOFF_FACTOR 4  // 새로고침 간격 >= (평균 읽기 시간 * 이 값): 오래 걸리는 폴더는 CPU/IO의 1/이 값 이하만 사용
+#define FS_WATCHDOG_USEC (2 * 1000 * 1000)  // 폴더 읽기가 이보다 오래 걸리면: 해당 창 '응답 없음' 표시 (단위: μs)
+#define THREAD_JOIN_TIMEOUT_USEC (1 * 1000 * 1000)  // 종료 시 Thread 대기 최대 시간: 넘으면 기다리지 않고 종료 (단위: μs)
+#define STATS_DUMP_ENV "FILE_MANAGER_STATS"  // 이 환경 변수에 파일 경로 지정: 종료 시 Thread 통계 저장
+#define TRACE_ENV "FILE_MANAGER_TRACE"  // 이 환경 변수 (or `--trace 파일`)에 파일 경로 지정: 구간별 소요 시간 기록, 종료 시 Chrome Trace (JSON)로 저장
+#define TRACE_BUFFER_EVENTS 16384  // Thread마다 기록하는 최근 구간 수 (Ring Buffer 크기)
 
 #define MAX_DIRWINS 3  // 최대 가능한 '탭' 수
 #define MAX_DIR_ENTRIES 1000  // 한 폴더에 표시 가능한 최대 Item 수
@@ -23,14 +34,41 @@
 #ifndef PATH_MAX
 #define PATH_MAX 4096  // 폴더의 최대 경로 길이
 #endif
-#define COPY_FILE_BUF_SIZE (4 * 1024)  // 4KB; copy_file_range 사용 불가한 경우, read() -> write()로 fallback됨
+#define COPY_BUF_MIN_SIZE (1024 * 1024)  // 1MB; copy_file_range, splice 모두 사용 불가한 경우의 read() -> write() Chunk 최소 크기
+#define COPY_BUF_MAX_SIZE (16 * 1024 * 1024)  // 16MB; Chunk 최대 크기 (원본이 회전 디스크: 항상 이 크기)
+#define COPY_BUF_BLOCKS 256  // Chunk 크기 = 원본/대상 중 큰 st_blksize x 이 값 (위 범위로 제한)
+#define COPY_BUF_POOL_SIZE (MAX_FILE_OPERATORS * 2)  // 재사용하려고 남겨 둘 Buffer 최대 수 (복사 1개당 2개: 읽기/쓰기 겹침, `COPY_BUF_MIN_SIZE` 이하만 남김)
+#define SPLICE_PIPE_SIZE (1024 * 1024)  // splice() 복사에 사용할 Pipe 크기 (F_SETPIPE_SZ, 실패: 기본 크기 사용)
+#define STREAM_FLUSH_SIZE (8 * 1024 * 1024)  // Streaming 복사: 이만큼 쓸 때마다 Writeback 시작, 그 전 구간은 Writeback 끝난 후 Page Cache에서 제거
+#define URING_ENTRIES 64  // io_uring 복사 (make IO_URING=1)의 Submission Queue 크기 (URING_COPY_DEPTH x 4 이상)
+#define URING_COPY_DEPTH 8  // io_uring으로 한 번에 복사하는 작은 파일 수 or 큰 파일의 Chunk 수 (Thread마다 Buffer 이만큼 등록)
+#define URING_BUF_SIZE (256 * 1024)  // io_uring 복사 Buffer 1개 크기 (폴더 복사 중 이 크기 이하 파일: 여러 개 묶어 복사)
 
 #define MAX_FILE_OPERATORS 4
+#define MAX_FILE_JOBS 64  // 파일 작업 Queue 크기 (대기 + 실행 중 + 끝난 작업 기록)
+#define FILE_JOB_RESERVED_WORKERS 1  // 우선순위 HIGH 작업 (이름 변경 등) 전용 File Operator 수: 대량 복사가 모두 차지하지 않게
+#define COPY_JOB_MAX_WORKERS MAX_FILE_OPERATORS  // 폴더 복사 1개에 동시에 참여하는 최대 Thread 수 (작업 받은 Thread 포함, 1: 병렬 복사 X)
+#define FILE_JOB_PATH_LEN 256  // 작업 창에 표시할 원본/대상 경로 최대 길이 (넘으면: 앞부분 잘림)
+#define JOB_RATE_SAMPLE_USEC (500 * 1000)  // 작업 창의 전송 속도 계산 간격 (단위: μs)
+
+// 병렬 정렬
+#define SORT_THREADS 0  // 정렬에 사용할 Thread 수 (0: 사용 가능한 CPU 수)
+#define MAX_SORT_THREADS 16  // 정렬 Thread 수 상한
+#define PARALLEL_SORT_MIN_ITEMS 512  // 이보다 항목이 적으면: 단일 Thread로 정렬
 
 // 날짜 및 시간 출력 형식
 #define DATETIME_FORMAT "%2.2d-%2.2d-%2.2d %2.2d:%2.2d:%2.2d"  // 날짜-시간 문자열 형식 (printf 형식)
 #define DATETIME_LEN 19  // 날짜-시간 문자열 길이
 
+#define RENDER_CACHE_SIZE 256  // 창별 출력 Cache 줄 수 (2의 거듭제곱, 화면 줄 수보다 충분히 크게)
+#define RENDER_ROW_LEN 80  // 출력 Cache 1줄의 최대 길이
+
+#define CURSOR_EVENT_QUEUE_SIZE 64  // 창별 커서 이동 Event Queue 크기 (넘치면: 미리 합쳐 둠)
+#define MAX_JUMP_PREFIX_LEN 63  // 이름으로 이동할 때 입력 가능한 최대 길이
+
+#define MAX_EXTRA_COLOR_PAIRS 64  // LS_COLORS용으로 추가 가능한 최대 색상 Pair 수 (PAIR_LAST + 이 값 <= 256)
+#define MAX_CLASSIFIED_EXTS 1024  // 색상 구분에 사용할 최대 확장자 수
+
 #define MAX_BOTTOMBOX_MSG_LEN 64  // 하단 영역 메시지의 최대 길이 (화면 Size와 상관 없이)
 #define MAX_POPUP_TITLE_LEN 64  // 하단 영역 메시지의 최대 길이 (화면 Size와 상관 없이)
 
@@ -0,0 +1,109 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "config.h"
+#include "cursor_event.h"
+
+
+/**
+ * Event 1개를 합쳐진 이동에 반영
+ *
+ * @param move 합쳐진 이동
+ * @param event 반영할 Event
+ * @param prefix CURSOR_JUMP_PREFIX로 찾을 문자열
+ */
+static void foldCursorEvent(CursorMove *move, const CursorEvent *event, const char *prefix);
+
+
+void pushCursorEvent(CursorEventQueue *queue, CursorEventType type, size_t index) {
+    if (queue->count == CURSOR_EVENT_QUEUE_SIZE) {
+        // 가득 참: 쌓인 Event들 pending에 합침
+        queue->pending = drainCursorEvents(queue);
+    }
+    CursorEvent *event = &queue->events[(queue->head + queue->count) % CURSOR_EVENT_QUEUE_SIZE];
+    event->type = type;
+    event->index = index;
+    queue->count++;
+}
+
+void pushCursorJumpPrefix(CursorEventQueue *queue, const char *prefix) {
+    strncpy(queue->prefix, prefix, MAX_JUMP_PREFIX_LEN);
+    queue->prefix[MAX_JUMP_PREFIX_LEN] = '\0';
+    pushCursorEvent(queue, CURSOR_JUMP_PREFIX, 0);
+}
+
+CursorMove drainCursorEvents(CursorEventQueue *queue) {
+    CursorMove move = queue->pending;
+
+    for (; queue->count > 0; queue->count--) {
+        foldCursorEvent(&move, &queue->events[queue->head], queue->prefix);
+        queue->head = (queue->head + 1) % CURSOR_EVENT_QUEUE_SIZE;
+    }
+    memset(&queue->pending, 0, sizeof(CursorMove));
+    return move;
+}
+
+size_t applyCursorMove(const CursorMove *move, size_t pos, size_t itemsCnt, size_t pageSize, size_t prefixPos) {
+    if (itemsCnt == 0)
+        return 0;
+
+    ssize_t newPos = pos;
+    if (move->hasAnchor) {
+        switch (move->anchor) {
+            case CURSOR_HOME:
+                newPos = 0;
+                break;
+            case CURSOR_END:
+                newPos = itemsCnt - 1;
+                break;
+            case CURSOR_JUMP_INDEX:
+                newPos = move->anchorIndex < itemsCnt ? move->anchorIndex : itemsCnt - 1;
+                break;
+            case CURSOR_JUMP_PREFIX:
+                newPos = prefixPos;
+                break;
+            default:
+                break;
+        }
+    }
+    newPos += move->lines + move->pages * (ssize_t)(pageSize > 0 ? pageSize : 1);
+
+    // 범위 안으로
+    if (newPos < 0)
+        return 0;
+    if ((size_t)newPos >= itemsCnt)
+        return itemsCnt - 1;
+    return newPos;
+}
+
+void foldCursorEvent(CursorMove *move, const CursorEvent *event, const char *prefix) {
+    switch (event->type) {
+        case CURSOR_UP:
+            move->lines--;
+            return;
+        case CURSOR_DOWN:
+            move->lines++;
+            return;
+        case CURSOR_PAGE_UP:
+            move->pages--;
+            return;
+        case CURSOR_PAGE_DOWN:
+            move->pages++;
+            return;
+        case CURSOR_HOME:
+        case CURSOR_END:
+        case CURSOR_JUMP_INDEX:
+        case CURSOR_JUMP_PREFIX:
+            // 절대 위치 이동: 이전 이동 모두 무시
+            move->hasAnchor = true;
+            move->anchor = event->type;
+            move->anchorIndex = event->index;
+            if (event->type == CURSOR_JUMP_PREFIX)
+                strcpy(move->prefix, prefix);
+            move->lines = 0;
+            move->pages = 0;
+            return;
+    }
+}
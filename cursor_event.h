@@ -0,0 +1,118 @@
+#ifndef _CURSOR_EVENT_H_INCLUDED_
+#define _CURSOR_EVENT_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "config.h"
+
+
+/**
+ * 커서 이동 Event 종류
+ */
+typedef enum _CursorEventType {
+    CURSOR_UP,  // 한 칸 위로
+    CURSOR_DOWN,  // 한 칸 아래로
+    CURSOR_PAGE_UP,  // 한 화면 위로
+    CURSOR_PAGE_DOWN,  // 한 화면 아래로
+    CURSOR_HOME,  // 맨 위로
+    CURSOR_END,  // 맨 아래로
+    CURSOR_JUMP_INDEX,  // 지정한 Index로
+    CURSOR_JUMP_PREFIX  // 이름이 지정한 문자열로 시작하는 첫 항목으로
+} CursorEventType;
+
+/**
+ * @struct _CursorEvent
+ *
+ * @var _CursorEvent::type Event 종류
+ * @var _CursorEvent::index 이동할 Index (CURSOR_JUMP_INDEX만 사용)
+ */
+typedef struct _CursorEvent {
+    CursorEventType type;  // Event 종류
+    size_t index;  // 이동할 Index (CURSOR_JUMP_INDEX)
+} CursorEvent;
+
+/**
+ * @struct _CursorMove
+ * 여러 Event를 합친 최종 이동
+ *
+ * @var _CursorMove::hasAnchor 절대 위치 이동 (HOME, END, JUMP_*) 포함 여부 (false: 현재 위치 기준)
+ * @var _CursorMove::anchor 마지막 절대 위치 이동 종류 (hasAnchor인 경우만 유효)
+ * @var _CursorMove::anchorIndex 이동할 Index (anchor가 CURSOR_JUMP_INDEX인 경우)
+ * @var _CursorMove::prefix 찾을 이름 앞부분 (anchor가 CURSOR_JUMP_PREFIX인 경우)
+ * @var _CursorMove::lines 절대 위치 이동 이후의 상대 이동 (줄 단위, 음수: 위로)
+ * @var _CursorMove::pages 절대 위치 이동 이후의 상대 이동 (화면 단위, 음수: 위로)
+ */
+typedef struct _CursorMove {
+    bool hasAnchor;
+    CursorEventType anchor;
+    size_t anchorIndex;
+    char prefix[MAX_JUMP_PREFIX_LEN + 1];
+    ssize_t lines;
+    ssize_t pages;
+} CursorMove;
+
+/**
+ * @struct _CursorEventQueue
+ * 커서 이동 Event Ring Buffer (Main Thread 전용)
+ *
+ * @var _CursorEventQueue::events Event 저장 공간
+ * @var _CursorEventQueue::head 가장 오래된 Event 위치
+ * @var _CursorEventQueue::count 저장된 Event 수
+ * @var _CursorEventQueue::prefix CURSOR_JUMP_PREFIX로 찾을 문자열 (마지막으로 넣은 값)
+ * @var _CursorEventQueue::pending 공간 부족해 미리 합친 Event들
+ */
+typedef struct _CursorEventQueue {
+    CursorEvent events[CURSOR_EVENT_QUEUE_SIZE];
+    unsigned int head;
+    unsigned int count;
+    char prefix[MAX_JUMP_PREFIX_LEN + 1];
+    CursorMove pending;
+} CursorEventQueue;
+
+
+/**
+ * Event 추가
+ *
+ * @param queue Event Queue
+ * @param type Event 종류
+ * @param index 이동할 Index (CURSOR_JUMP_INDEX만 사용)
+ *
+ * @details
+ * - Queue 가득 참: 쌓인 Event들을 먼저 합쳐 둠 (버리지 않음)
+ */
+void pushCursorEvent(CursorEventQueue *queue, CursorEventType type, size_t index);
+
+/**
+ * 이름 앞부분으로 이동하는 Event 추가
+ *
+ * @param queue Event Queue
+ * @param prefix 찾을 문자열 (`MAX_JUMP_PREFIX_LEN`보다 길면 잘림)
+ */
+void pushCursorJumpPrefix(CursorEventQueue *queue, const char *prefix);
+
+/**
+ * 쌓인 Event들을 하나의 이동으로 합치고 Queue 비움
+ *
+ * @param queue Event Queue
+ * @return 최종 이동 (applyCursorMove 참조)
+ *
+ * @details
+ * - 절대 위치 이동: 이전 Event 모두 무시 -> 마지막 절대 위치 이동 + 이후 상대 이동만 남음
+ */
+CursorMove drainCursorEvents(CursorEventQueue *queue);
+
+/**
+ * 합쳐진 이동을 현재 위치에 적용
+ *
+ * @param move 최종 이동
+ * @param pos 현재 위치
+ * @param itemsCnt 전체 항목 수
+ * @param pageSize 한 화면의 줄 수
+ * @param prefixPos CURSOR_JUMP_PREFIX로 찾은 위치 (호출한 쪽에서 검색, 못 찾음: pos)
+ * @return 새 위치 ( [0, itemsCnt) ), 항목 없음: 0
+ */
+size_t applyCursorMove(const CursorMove *move, size_t pos, size_t itemsCnt, size_t pageSize, size_t prefixPos);
+
+#endif
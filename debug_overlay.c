@@ -0,0 +1,162 @@
+#include <curses.h>
+#include <panel.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "colors.h"
+#include "commons.h"
+#include "debug_overlay.h"
+#include "thread_commons.h"
+
+#define OVERLAY_W 44  // Overlay 창 폭
+#define OVERLAY_H 5  // Overlay 창 높이
+
+
+static WINDOW *overlayWindow;
+static PANEL *overlayPanel;
+static bool isOverlayShown;
+
+static struct timespec fpsWindowStart;  // Frame 수 세기 시작한 시간 (Clock: CLOCK_MONOTONIC)
+static unsigned int framesInWindow;  // fpsWindowStart 이후 그린 Frame 수
+static unsigned int lastFps;  // 직전 1초 동안 그린 Frame 수
+
+bool isFrameTimingOn;
+
+static uint64_t frameStartUSec;  // 이번 Frame 시작 시간 (0: 측정 중 아님)
+static uint64_t stageStartUSec;  // 현재 구간 시작 시간 (= 직전 구간 끝)
+static uint64_t keyArrivalUSec;  // 이번 Frame에 반영할 첫 키 입력 도착 시간 (0: 없음)
+static uint64_t stageSumUSec[FRAME_STAGE_CNT];  // fpsWindowStart 이후 구간별 시간 합
+static uint64_t frameSumUSec;  // fpsWindowStart 이후 Frame 시간 합
+static uint64_t frameMaxUSec;  // fpsWindowStart 이후 가장 오래 걸린 Frame
+static unsigned int timedFrames;  // fpsWindowStart 이후 측정한 Frame 수
+static uint64_t lastStageAvgUSec[FRAME_STAGE_CNT];  // 직전 1초 구간별 평균 시간
+static uint64_t lastFrameAvgUSec;  // 직전 1초 Frame 시간 평균
+static uint64_t lastFrameMaxUSec;  // 직전 1초 Frame 시간 최대
+static uint64_t lastKeyLatencyUSec;  // 마지막 키 입력 ~ 화면 반영 (doupdate() 끝)
+
+
+void initDebugOverlay(void) {
+    overlayWindow = newwin(OVERLAY_H, OVERLAY_W, 2, COLS > OVERLAY_W ? COLS - OVERLAY_W : 0);
+    if (overlayWindow == NULL) {
+        return;
+    }
+    if (isColorSafe) {
+        wbkgd(overlayWindow, COLOR_PAIR(POPUP));
+    }
+    overlayPanel = new_panel(overlayWindow);
+    hide_panel(overlayPanel);
+    clock_gettime(CLOCK_MONOTONIC, &fpsWindowStart);
+}
+
+void delDebugOverlay(void) {
+    if (overlayWindow == NULL)
+        return;
+    del_panel(overlayPanel);
+    delwin(overlayWindow);
+}
+
+void toggleDebugOverlay(void) {
+    if (overlayWindow == NULL)
+        return;
+    isOverlayShown = !isOverlayShown;
+    isFrameTimingOn = isOverlayShown;  // 숨김: 구간 측정도 끔
+    frameStartUSec = 0;  // 이번 Frame: 시작 시간 모름 -> 다음 Frame부터 측정
+    keyArrivalUSec = 0;
+    if (isOverlayShown) {
+        show_panel(overlayPanel);
+    } else {
+        hide_panel(overlayPanel);
+    }
+}
+
+void beginFrameTiming(void) {
+    frameStartUSec = getMonotonicUSec();
+    stageStartUSec = frameStartUSec;
+}
+
+void endFrameStage(FrameStage stage) {
+    if (frameStartUSec == 0)  // 측정 도중에 켜짐: 다음 Frame부터
+        return;
+
+    uint64_t nowUSec = getMonotonicUSec();
+    stageSumUSec[stage] += nowUSec - stageStartUSec;
+    stageStartUSec = nowUSec;
+    if (stage != FRAME_STAGE_DRAW)
+        return;
+
+    // 마지막 구간: Frame 끝
+    uint64_t frameUSec = nowUSec - frameStartUSec;
+    frameSumUSec += frameUSec;
+    if (frameUSec > frameMaxUSec)
+        frameMaxUSec = frameUSec;
+    timedFrames++;
+    if (keyArrivalUSec != 0) {
+        lastKeyLatencyUSec = nowUSec - keyArrivalUSec;
+        keyArrivalUSec = 0;
+    }
+    frameStartUSec = 0;
+}
+
+void noteKeyArrival(void) {
+    if (keyArrivalUSec == 0)
+        keyArrivalUSec = getMonotonicUSec();
+}
+
+void updateDebugOverlay(uint32_t wakeSources, uint64_t frameIntervalUSec) {
+    // 1초마다 Frame 수 집계
+    framesInWindow++;
+    uint64_t elapsedUSec = getElapsedTime(fpsWindowStart);
+    if (elapsedUSec >= 1000 * 1000) {
+        lastFps = framesInWindow * (1000 * 1000) / elapsedUSec;
+        framesInWindow = 0;
+        // 구간 시간: 직전 1초 평균으로 표시 (Frame마다 바뀌면 읽기 어려움)
+        for (int i = 0; i < FRAME_STAGE_CNT; i++) {
+            lastStageAvgUSec[i] = timedFrames ? stageSumUSec[i] / timedFrames : 0;
+            stageSumUSec[i] = 0;
+        }
+        lastFrameAvgUSec = timedFrames ? frameSumUSec / timedFrames : 0;
+        lastFrameMaxUSec = frameMaxUSec;
+        frameSumUSec = frameMaxUSec = 0;
+        timedFrames = 0;
+        clock_gettime(CLOCK_MONOTONIC, &fpsWindowStart);
+    }
+
+    if (!isOverlayShown)
+        return;
+
+    move_panel(overlayPanel, 2, COLS > OVERLAY_W ? COLS - OVERLAY_W : 0);  // 창 크기 바뀌었을 수 있음: 오른쪽 위에 붙임
+    // 깨운 원인: K(키 입력) R(창 크기) D(새 결과) P(진행률) T(시계)
+    char reasons[] = {
+        wakeSources & UI_WAKE_KEY ? 'K' : '-',
+        wakeSources & UI_WAKE_RESIZE ? 'R' : '-',
+        wakeSources & UI_WAKE_DATA ? 'D' : '-',
+        wakeSources & UI_WAKE_PROGRESS ? 'P' : '-',
+        wakeSources & UI_WAKE_TIMER ? 'T' : '-',
+        '\0'
+    };
+    char times[FRAME_STAGE_CNT + 3][16];
+    for (int i = 0; i < FRAME_STAGE_CNT; i++)
+        formatUSec(lastStageAvgUSec[i], times[i], sizeof(times[i]));
+    formatUSec(lastFrameAvgUSec, times[FRAME_STAGE_CNT], sizeof(times[FRAME_STAGE_CNT]));
+    formatUSec(lastFrameMaxUSec, times[FRAME_STAGE_CNT + 1], sizeof(times[FRAME_STAGE_CNT + 1]));
+    formatUSec(lastKeyLatencyUSec, times[FRAME_STAGE_CNT + 2], sizeof(times[FRAME_STAGE_CNT + 2]));
+
+    werase(overlayWindow);
+    if (frameIntervalUSec > 0) {
+        mvwprintw(overlayWindow, 0, 1, "%3u fps | cap %4u fps | %s", lastFps, (unsigned int)((1000 * 1000) / frameIntervalUSec), reasons);
+    } else {
+        mvwprintw(overlayWindow, 0, 1, "%3u fps | cap   none   | %s", lastFps, reasons);
+    }
+    mvwprintw(overlayWindow, 1, 1, "frame avg %7s max %7s", times[FRAME_STAGE_CNT], times[FRAME_STAGE_CNT + 1]);
+    mvwprintw(
+        overlayWindow, 2, 1, "input %7s prog %7s title %7s",
+        times[FRAME_STAGE_INPUT], times[FRAME_STAGE_PROGRESS], times[FRAME_STAGE_TITLE]
+    );
+    mvwprintw(
+        overlayWindow, 3, 1, "dirs  %7s wins %7s draw  %7s",
+        times[FRAME_STAGE_DIRWINS], times[FRAME_STAGE_WINDOWS], times[FRAME_STAGE_DRAW]
+    );
+    mvwprintw(overlayWindow, 4, 1, "key -> screen %7s", times[FRAME_STAGE_CNT + 2]);
+}
@@ -0,0 +1,87 @@
+#ifndef _DEBUG_OVERLAY_H_INCLUDED_
+#define _DEBUG_OVERLAY_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Frame 시작: 구간 측정 기준 시간 기록 (Overlay 숨김: 분기 1회)
+#define FRAME_STAGE_BEGIN() do { \
+    if (__builtin_expect(isFrameTimingOn, 0)) \
+        beginFrameTiming(); \
+} while (0)
+// 구간 끝: 직전 구간 끝 ~ 현재까지를 해당 구간 시간으로 기록 (Overlay 숨김: 분기 1회)
+#define FRAME_STAGE_END(stage) do { \
+    if (__builtin_expect(isFrameTimingOn, 0)) \
+        endFrameStage(stage); \
+} while (0)
+// 키 입력 도착: 화면 반영까지 지연 측정 시작 (Overlay 숨김: 분기 1회)
+#define FRAME_KEY_ARRIVED() do { \
+    if (__builtin_expect(isFrameTimingOn, 0)) \
+        noteKeyArrival(); \
+} while (0)
+
+
+/**
+ * @enum _FrameStage
+ * Frame 1개를 나눈 구간 (Main Loop 순서)
+ */
+typedef enum _FrameStage {
+    FRAME_STAGE_INPUT,  // 키 입력 처리
+    FRAME_STAGE_PROGRESS,  // 파일 작업 결과, 폴더 변경 실패 확인
+    FRAME_STAGE_TITLE,  // 제목 창 (현재 경로), 창 상태 반영
+    FRAME_STAGE_DIRWINS,  // 폴더 표시 창들, 하단 영역
+    FRAME_STAGE_WINDOWS,  // 프로세스 창, 팝업 창
+    FRAME_STAGE_DRAW,  // Overlay, 패널 정리, doupdate() (마지막 구간: Frame 끝)
+    FRAME_STAGE_CNT
+} FrameStage;
+
+
+extern bool isFrameTimingOn;  // 구간 측정 여부 (Overlay 표시 중)
+
+
+/**
+ * 화면 갱신 정보 (Debug Overlay) 창 초기화 (숨겨진 상태로 생성)
+ */
+void initDebugOverlay(void);
+
+/**
+ * Debug Overlay 창 자원 해제
+ */
+void delDebugOverlay(void);
+
+/**
+ * Debug Overlay 표시/숨김 전환
+ */
+void toggleDebugOverlay(void);
+
+/**
+ * Frame 구간 측정 시작 (FRAME_STAGE_BEGIN 사용)
+ */
+void beginFrameTiming(void);
+
+/**
+ * 구간 1개 끝났음을 기록 (FRAME_STAGE_END 사용)
+ *
+ * @param stage 끝난 구간 (FRAME_STAGE_DRAW: Frame 시간, 키 입력 ~ 화면 반영 지연 함께 기록)
+ */
+void endFrameStage(FrameStage stage);
+
+/**
+ * 키 입력 도착 시간 기록 (FRAME_KEY_ARRIVED 사용, 이번 Frame의 첫 입력만 기록)
+ */
+void noteKeyArrival(void);
+
+/**
+ * Frame 1회 그렸음을 기록하고, 표시 중이면 내용 갱신 (매 Frame 1회 호출)
+ *
+ * @param wakeSources 이번 Frame을 깨운 원인들 (UI_WAKE_* bitmask)
+ * @param frameIntervalUSec 이번 Frame에 적용된 최소 갱신 간격 (단위: μs, 0: 제한 없음)
+ *
+ * @details
+ * - 표시 내용: 최근 1초간 Frame 수, 적용된 간격 (→ 최대 Frame rate), 깨운 원인
+ * - 직전 1초간 Frame 시간 평균/최대, 구간별 평균 시간, 마지막 키 입력 ~ 화면 반영 지연
+ */
+void updateDebugOverlay(uint32_t wakeSources, uint64_t frameIntervalUSec);
+
+#endif
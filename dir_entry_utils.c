@@ -1,3 +1,4 @@
+#include <ctype.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -7,61 +8,61 @@
 #include "config.h"
 #include "dir_entry_utils.h"
 #include "dir_window.h"
+#include "parallel_sort.h"
 
+_Static_assert(MAX_DIR_ENTRIES <= UINT16_MAX, "Name index stores entry indices as uint16_t");
 
-/**
- * 이름 기준 오름차순 비교
- *
- * @param a 첫 번째 DirEntry의 포인터
- * @param b 두 번째 DirEntry의 포인터
- * @return a가 b보다 작으면 음수, 크면 양수, 같으면 0
- */
-static int cmpNameAsc(const void *a, const void *b);
 
 /**
- * 이름 기준 내림차순 비교
+ * 정렬 Key 조합에 따라 두 항목 비교 (qsort_r용)
  *
  * @param a 첫 번째 DirEntry의 포인터
  * @param b 두 번째 DirEntry의 포인터
- * @return a가 b보다 크면 음수, 작으면 양수, 같으면 0
+ * @param sortKeysPtr 정렬 Key 조합 (uint16_t)의 포인터
+ * @return a가 앞에 와야 하면 음수, 뒤에 와야 하면 양수, 같으면 0
+ *
+ * @details
+ * - ".."는 항상 최상단, 폴더는 항상 파일보다 위
+ * - 이후 Key 순서대로 비교, 모두 같으면 이름 비교 (방향: 1순위 Key 따름)
  */
-static int cmpNameDesc(const void *a, const void *b);
+static int compareEntries(const void *a, const void *b, void *sortKeysPtr);
 
 /**
- * 크기 기준 오름차순 비교
+ * 정렬 Key 1개 기준으로 두 항목 비교 (방향 미적용)
  *
- * @param a 첫 번째 DirEntry의 포인터
- * @param b 두 번째 DirEntry의 포인터
+ * @param entryA 첫 번째 항목
+ * @param entryB 두 번째 항목
+ * @param criterion 정렬 기준 (DIRLISTENER_SORTKEY_NAME 등)
  * @return a가 b보다 작으면 음수, 크면 양수, 같으면 0
  */
-static int cmpSizeAsc(const void *a, const void *b);
+static inline int compareByCriterion(const DirEntry *entryA, const DirEntry *entryB, int criterion);
 
 /**
- * 크기 기준 내림차순 비교
+ * 확장자 Group 이름 비교 (qsort용, 폴더 "/" -> 확장자 없음 "" -> 나머지 이름순)
  *
- * @param a 첫 번째 DirEntry의 포인터
- * @param b 두 번째 DirEntry의 포인터
- * @return a가 b보다 크면 음수, 작으면 양수, 같으면 0
+ * @param a 첫 번째 ExtGroup의 포인터
+ * @param b 두 번째 ExtGroup의 포인터
+ * @return a가 b보다 작으면 음수, 크면 양수, 같으면 0
  */
-static int cmpSizeDesc(const void *a, const void *b);
+static int compareExtGroups(const void *a, const void *b);
 
 /**
- * 날짜 기준 오름차순 비교
+ * 이름 Index용 두 항목 이름 비교 (qsort_r용, 대소문자 구분 X)
  *
- * @param a 첫 번째 DirEntry의 포인터
- * @param b 두 번째 DirEntry의 포인터
+ * @param a 첫 번째 항목 Index (uint16_t)의 포인터
+ * @param b 두 번째 항목 Index (uint16_t)의 포인터
+ * @param dirEntriesPtr 디렉토리 항목 배열
  * @return a가 b보다 작으면 음수, 크면 양수, 같으면 0
  */
-static int cmpDateAsc(const void *a, const void *b);
+static int compareNameIndex(const void *a, const void *b, void *dirEntriesPtr);
 
 /**
- * 날짜 기준 내림차순 비교
+ * 파일 종류 정렬 순위
  *
- * @param a 첫 번째 DirEntry의 포인터
- * @param b 두 번째 DirEntry의 포인터
- * @return a가 b보다 크면 음수, 작으면 양수, 같으면 0
+ * @param mode stat의 st_mode
+ * @return 순위 (작을수록 위)
  */
-static int cmpDateDesc(const void *a, const void *b);
+static inline int fileTypeRank(mode_t mode);
 
 
 char *truncateFileName(const char *fileName) {
@@ -97,151 +98,147 @@ int isHidden(const char *fileName) {
     return fileName[0] == '.' && strcmp(fileName, ".") != 0 && strcmp(fileName, "..") != 0;
 }
 
-int isImageFile(const char *fileName) {
-    const char *extensions[] = { ".jpg", ".jpeg", ".png", ".gif", ".bmp" };
-    size_t numExtensions = sizeof(extensions) / sizeof(extensions[0]);
+void fillNameInfo(DirEntry *entry) {
+    size_t len = strlen(entry->entryName);
+    const char *dot = strrchr(entry->entryName, '.');  // 마지막 '.' 위치 찾기
 
-    const char *dot = strrchr(fileName, '.');  // 마지막 '.' 위치 찾기
-    if (dot) {
-        for (size_t i = 0; i < numExtensions; i++) {
-            if (strcasecmp(dot, extensions[i]) == 0) {  // 대소문자 구분 없이 비교
-                return 1;
-            }
-        }
-    }
-    return 0;
+    entry->nameLen = len;
+    // '.'으로 시작하는 이름의 첫 '.', 마지막 글자 '.'은 확장자로 보지 않음
+    if (dot != NULL && dot != entry->entryName && dot[1] != '\0')
+        entry->extOffset = dot - entry->entryName;
+    else
+        entry->extOffset = len;
 }
 
-int isEXE(const char *fileName) {
-    const char *extensions[] = { ".exe", ".out" };
-    size_t numExtensions = sizeof(extensions) / sizeof(extensions[0]);
-
-    const char *dot = strrchr(fileName, '.');  // 마지막 '.' 위치 찾기
-    if (dot) {
-        for (size_t i = 0; i < numExtensions; i++) {
-            if (strcasecmp(dot, extensions[i]) == 0) {  // 대소문자 구분 없이 비교
-                return 1;
-            }
-        }
-    }
-    return 0;
-}
-
-void applySorting(DirEntry *dirEntries, uint16_t flags, size_t totalReadItems) {
+void applySorting(DirEntry *dirEntries, uint16_t sortKeys, size_t totalReadItems) {
     if (!dirEntries || totalReadItems == 0) {
         fprintf(stderr, "Invalid input to applySorting: dirEntries=%p, totalReadItems=%zu\n", dirEntries, totalReadItems);
         return;
     }
 
-    int (*compareFunc)(const void *, const void *) = NULL;
+    parallelSort(dirEntries, totalReadItems, sizeof(DirEntry), compareEntries, &sortKeys);
+}
 
-    uint16_t criterion = flags & DIRLISTENER_FLAG_SORT_CRITERION_MASK;  // 정렬 기준
-    uint16_t direction = flags & DIRLISTENER_FLAG_SORT_REVERSE;  // 내림차순 정렬?
-    switch (criterion) {
-        case DIRLISTENER_FLAG_SORT_SIZE:
-            compareFunc = direction ? cmpSizeDesc : cmpSizeAsc;
-            break;
-        case DIRLISTENER_FLAG_SORT_DATE:
-            compareFunc = direction ? cmpDateDesc : cmpDateAsc;
-            break;
-        default:
-            compareFunc = direction ? cmpNameDesc : cmpNameAsc;
-            break;
-    }
+size_t insertSortedEntry(DirEntry *dirEntries, size_t *totalItems, const DirEntry *newEntry, uint16_t sortKeys) {
+    size_t low = 0, high = *totalItems;
 
-    // 정렬 함수가 설정되었으면, DirEntry 배열을 정렬
-    if (compareFunc != NULL) {
-        qsort(dirEntries, totalReadItems, sizeof(DirEntry), compareFunc);
-    } else {
-        fprintf(stderr, "Invalid sorting flags: flags=%u (criterion=%u, direction=%u)\n", flags, criterion, direction);
+    // 이진 탐색: newEntry보다 '큰' 첫 항목 위치 찾기
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        if (compareEntries(newEntry, &dirEntries[mid], &sortKeys) < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
     }
-}
-
-// 정렬 비교 들수들
-int cmpDateAsc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
 
-    // ".."는 최상단
-    if (strcmp(entryA->entryName, "..") == 0) return -1;
-    if (strcmp(entryB->entryName, "..") == 0) return 1;
+    // 삽입 위치 뒤쪽 항목들 한 칸씩 밀고, 삽입
+    memmove(&dirEntries[low + 1], &dirEntries[low], (*totalItems - low) * sizeof(DirEntry));
+    dirEntries[low] = *newEntry;
+    (*totalItems)++;
+    return low;
+}
 
+void removeSortedEntry(DirEntry *dirEntries, size_t *totalItems, size_t index) {
+    if (index >= *totalItems)
+        return;
+    memmove(&dirEntries[index], &dirEntries[index + 1], (*totalItems - index - 1) * sizeof(DirEntry));
+    (*totalItems)--;
+}
 
-    // 디렉토리는 상단
-    if (S_ISDIR(entryA->statEntry.st_mode) && !S_ISDIR(entryB->statEntry.st_mode)) {
-        return -1;
-    } else if (!S_ISDIR(entryA->statEntry.st_mode) && S_ISDIR(entryB->statEntry.st_mode)) {
-        return 1;
+void mergeSortedEntries(DirEntry *dirEntries, size_t *totalItems, DirEntry *delta, size_t deltaCnt, uint16_t sortKeys) {
+    if (deltaCnt == 0)
+        return;
+    if (deltaCnt == 1) {  // 1개: 이진 탐색 후 삽입
+        insertSortedEntry(dirEntries, totalItems, delta, sortKeys);
+        return;
     }
 
-    // 초 단위 비교
-    if (entryA->statEntry.st_mtim.tv_sec < entryB->statEntry.st_mtim.tv_sec)
-        return -1;
-    if (entryA->statEntry.st_mtim.tv_sec > entryB->statEntry.st_mtim.tv_sec)
-        return 1;
-
-    // 초 단위가 같으면 나노초 단위 비교
-    if (entryA->statEntry.st_mtim.tv_nsec < entryB->statEntry.st_mtim.tv_nsec)
-        return -1;
-    if (entryA->statEntry.st_mtim.tv_nsec > entryB->statEntry.st_mtim.tv_nsec)
-        return 1;
+    parallelSort(delta, deltaCnt, sizeof(DirEntry), compareEntries, &sortKeys);  // 추가될 항목들만 정렬
 
-    return strcmp(entryA->entryName, entryB->entryName);  // 완전히 같으면 이름 비교
+    // 뒤쪽부터 채워 나가며 merge: 기존 항목들은 아직 읽지 않은 위치에만 덮어씌워짐 -> 별도 Buffer 불필요
+    size_t oldIdx = *totalItems;  // 기존 배열에서 다음에 볼 항목 (+1)
+    size_t deltaIdx = deltaCnt;  // delta에서 다음에 볼 항목 (+1)
+    size_t writeIdx = *totalItems + deltaCnt;  // 다음에 쓸 위치 (+1)
+    while (deltaIdx > 0) {
+        if (oldIdx > 0 && compareEntries(&dirEntries[oldIdx - 1], &delta[deltaIdx - 1], &sortKeys) > 0) {
+            dirEntries[--writeIdx] = dirEntries[--oldIdx];
+        } else {
+            dirEntries[--writeIdx] = delta[--deltaIdx];
+        }
+    }
+    // delta 모두 병합되면, 남은 기존 항목들은 이미 제자리에 있음
+    *totalItems += deltaCnt;
 }
 
-int cmpDateDesc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
+size_t groupByExtension(const DirEntry *dirEntries, size_t totalItems, ExtGroup *groups) {
+    size_t groupCnt = 0;
+    char ext[MAX_EXT_LEN + 1];
+    size_t g;
 
-    // ".."는 최상단
-    if (strcmp(entryA->entryName, "..") == 0) return -1;
-    if (strcmp(entryB->entryName, "..") == 0) return 1;
+    for (size_t i = 0; i < totalItems; i++) {
+        const DirEntry *entry = &dirEntries[i];
+        if (strcmp(entry->entryName, "..") == 0)  // 상위 폴더는 제외
+            continue;
 
+        // Group 이름: 폴더는 "/", 파일은 소문자 확장자
+        if (S_ISDIR(entry->statEntry.st_mode)) {
+            strcpy(ext, "/");
+        } else {
+            size_t extLen = entry->nameLen - entry->extOffset;
+            if (extLen > MAX_EXT_LEN)
+                extLen = MAX_EXT_LEN;
+            for (size_t j = 0; j < extLen; j++)
+                ext[j] = tolower((unsigned char)entry->entryName[entry->extOffset + j]);
+            ext[extLen] = '\0';
+        }
 
-    // 디렉토리는 상단
-    if (S_ISDIR(entryA->statEntry.st_mode) && !S_ISDIR(entryB->statEntry.st_mode)) {
-        return -1;
-    } else if (!S_ISDIR(entryA->statEntry.st_mode) && S_ISDIR(entryB->statEntry.st_mode)) {
-        return 1;
+        // 기존 Group 찾기 (Group 수는 보통 작음 -> 선형 탐색)
+        for (g = 0; g < groupCnt && strcmp(groups[g].ext, ext) != 0; g++);
+        if (g == groupCnt) {  // 새 Group
+            strcpy(groups[g].ext, ext);
+            groups[g].count = 0;
+            groups[g].totalBytes = 0;
+            groupCnt++;
+        }
+        groups[g].count++;
+        if (!S_ISDIR(entry->statEntry.st_mode))
+            groups[g].totalBytes += entry->statEntry.st_size;
     }
 
-    // 초 단위 비교
-    if (entryA->statEntry.st_mtim.tv_sec < entryB->statEntry.st_mtim.tv_sec)
-        return 1;
-    if (entryA->statEntry.st_mtim.tv_sec > entryB->statEntry.st_mtim.tv_sec)
-        return -1;
-
-    // 초 단위가 같으면 나노초 단위 비교
-    if (entryA->statEntry.st_mtim.tv_nsec < entryB->statEntry.st_mtim.tv_nsec)
-        return 1;
-    if (entryA->statEntry.st_mtim.tv_nsec > entryB->statEntry.st_mtim.tv_nsec)
-        return -1;
-
-    return -1 * (strcmp(entryA->entryName, entryB->entryName));  // 완전히 같으면 이름 비교
+    // 확장자 이름순 정렬 ("/" -> "" -> ".a" ...: 폴더, 확장자 없음 순으로 맨 위)
+    qsort(groups, groupCnt, sizeof(ExtGroup), compareExtGroups);
+    return groupCnt;
 }
 
-int cmpNameAsc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
-
-    // ".."는 최상단
-    if (strcmp(entryA->entryName, "..") == 0) return -1;
-    if (strcmp(entryB->entryName, "..") == 0) return 1;
+void buildNameIndex(const DirEntry *dirEntries, size_t totalItems, uint16_t *nameIndex) {
+    for (size_t i = 0; i < totalItems; i++)
+        nameIndex[i] = i;
+    qsort_r(nameIndex, totalItems, sizeof(uint16_t), compareNameIndex, (void *)dirEntries);
+}
 
-    // 디렉토리는 상단
-    if (S_ISDIR(entryA->statEntry.st_mode) && !S_ISDIR(entryB->statEntry.st_mode)) {
-        return -1;
-    } else if (!S_ISDIR(entryA->statEntry.st_mode) && S_ISDIR(entryB->statEntry.st_mode)) {
-        return 1;
+ssize_t findByNamePrefix(const DirEntry *dirEntries, const uint16_t *nameIndex, size_t totalItems, const char *prefix) {
+    size_t prefixLen = strlen(prefix);
+    size_t low = 0, high = totalItems;
+
+    // 이름 >= prefix인 첫 위치 (Lower bound): prefix로 시작하는 이름들은 그 위치부터 연속해 있음
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (strcasecmp(dirEntries[nameIndex[mid]].entryName, prefix) < 0)
+            low = mid + 1;
+        else
+            high = mid;
     }
-
-    // 이름 순 정렬
-    return strcmp(entryA->entryName, entryB->entryName);
+    if (low < totalItems && strncasecmp(dirEntries[nameIndex[low]].entryName, prefix, prefixLen) == 0)
+        return nameIndex[low];
+    return -1;
 }
 
-int cmpNameDesc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
+int compareEntries(const void *a, const void *b, void *sortKeysPtr) {
+    const DirEntry *entryA = (const DirEntry *)a;
+    const DirEntry *entryB = (const DirEntry *)b;
+    uint16_t sortKeys = *(uint16_t *)sortKeysPtr;
+    int key, ret;
 
     // ".."는 최상단
     if (strcmp(entryA->entryName, "..") == 0) return -1;
@@ -254,46 +251,79 @@ int cmpNameDesc(const void *a, const void *b) {
         return 1;
     }
 
-    // 이름 순 정렬
-    return -1 * (strcmp(entryA->entryName, entryB->entryName));
-}
+    // 각 Key 순서대로 비교
+    for (int i = 0; i < DIRLISTENER_MAX_SORT_KEYS; i++) {
+        key = DIRLISTENER_SORTKEY_GET(sortKeys, i);
+        if ((key & DIRLISTENER_SORTKEY_CRITERION_MASK) == DIRLISTENER_SORTKEY_NONE)
+            break;
+        ret = compareByCriterion(entryA, entryB, key & DIRLISTENER_SORTKEY_CRITERION_MASK);
+        if (ret != 0)
+            return (key & DIRLISTENER_SORTKEY_REVERSE) ? -ret : ret;
+    }
 
-int cmpSizeAsc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
+    // 완전히 같으면 이름 비교 (1순위 Key의 방향 따름)
+    ret = strcmp(entryA->entryName, entryB->entryName);
+    return (DIRLISTENER_SORTKEY_GET(sortKeys, 0) & DIRLISTENER_SORTKEY_REVERSE) ? -ret : ret;
+}
 
-    // ".."는 최상단
-    if (strcmp(entryA->entryName, "..") == 0) return -1;
-    if (strcmp(entryB->entryName, "..") == 0) return 1;
+int compareByCriterion(const DirEntry *entryA, const DirEntry *entryB, int criterion) {
+    const struct stat *statA = &entryA->statEntry;
+    const struct stat *statB = &entryB->statEntry;
 
-    // 디렉토리는 상단
-    if (S_ISDIR(entryA->statEntry.st_mode) && !S_ISDIR(entryB->statEntry.st_mode)) {
-        return -1;
-    } else if (!S_ISDIR(entryA->statEntry.st_mode) && S_ISDIR(entryB->statEntry.st_mode)) {
-        return 1;
+    switch (criterion) {
+        case DIRLISTENER_SORTKEY_NAME:
+            return strcmp(entryA->entryName, entryB->entryName);
+        case DIRLISTENER_SORTKEY_SIZE:
+            if (statA->st_size < statB->st_size) return -1;
+            if (statA->st_size > statB->st_size) return 1;
+            return 0;
+        case DIRLISTENER_SORTKEY_DATE:
+            // 초 단위 비교
+            if (statA->st_mtim.tv_sec < statB->st_mtim.tv_sec) return -1;
+            if (statA->st_mtim.tv_sec > statB->st_mtim.tv_sec) return 1;
+            // 초 단위가 같으면 나노초 단위 비교
+            if (statA->st_mtim.tv_nsec < statB->st_mtim.tv_nsec) return -1;
+            if (statA->st_mtim.tv_nsec > statB->st_mtim.tv_nsec) return 1;
+            return 0;
+        case DIRLISTENER_SORTKEY_EXT:
+            // 미리 계산된 확장자 위치 사용: strrchr() 불필요
+            return strcasecmp(entryA->entryName + entryA->extOffset, entryB->entryName + entryB->extOffset);
+        case DIRLISTENER_SORTKEY_TYPE:
+            return fileTypeRank(statA->st_mode) - fileTypeRank(statB->st_mode);
+        default:
+            return 0;
     }
-
-    if (entryA->statEntry.st_size < entryB->statEntry.st_size) return -1;  // a가 b보다 작으면 음수 반환
-    if (entryA->statEntry.st_size > entryB->statEntry.st_size) return 1;  // a가 b보다 크면 양수 반환
-    return (strcmp(entryA->entryName, entryB->entryName));  // a와 b가 같으면 이름 비교
 }
 
-int cmpSizeDesc(const void *a, const void *b) {
-    DirEntry *entryA = ((DirEntry *)a);
-    DirEntry *entryB = ((DirEntry *)b);
+int compareExtGroups(const void *a, const void *b) {
+    const char *extA = ((const ExtGroup *)a)->ext;
+    const char *extB = ((const ExtGroup *)b)->ext;
 
-    // ".."는 최상단
-    if (strcmp(entryA->entryName, "..") == 0) return -1;
-    if (strcmp(entryB->entryName, "..") == 0) return 1;
+    // 폴더 ("/") -> 확장자 없음 ("") 순으로 맨 위 (strcmp: '.'이 '/'보다 앞 -> 따로 처리)
+    int rankA = strcmp(extA, "/") == 0 ? 0 : (extA[0] == '\0' ? 1 : 2);
+    int rankB = strcmp(extB, "/") == 0 ? 0 : (extB[0] == '\0' ? 1 : 2);
+    if (rankA != rankB)
+        return rankA - rankB;
+    return strcmp(extA, extB);
+}
 
-    // 디렉토리는 상단
-    if (S_ISDIR(entryA->statEntry.st_mode) && !S_ISDIR(entryB->statEntry.st_mode)) {
-        return -1;
-    } else if (!S_ISDIR(entryA->statEntry.st_mode) && S_ISDIR(entryB->statEntry.st_mode)) {
-        return 1;
+int fileTypeRank(mode_t mode) {
+    switch (mode & S_IFMT) {
+        case S_IFDIR:
+            return 0;
+        case S_IFLNK:
+            return 1;
+        case S_IFREG:
+            return 2;
+        default:  // 장치 파일, FIFO, Socket 등
+            return 3;
     }
+}
 
-    if (entryA->statEntry.st_size < entryB->statEntry.st_size) return 1;  // a가 b보다 작으면 음수 반환
-    if (entryA->statEntry.st_size > entryB->statEntry.st_size) return -1;  // a가 b보다 크면 양수 반환
-    return -1 * (strcmp(entryA->entryName, entryB->entryName));  // a와 b가 같으면 이름 비교
+int compareNameIndex(const void *a, const void *b, void *dirEntriesPtr) {
+    const DirEntry *dirEntries = (const DirEntry *)dirEntriesPtr;
+    const char *nameA = dirEntries[*(const uint16_t *)a].entryName;
+    const char *nameB = dirEntries[*(const uint16_t *)b].entryName;
+    int ret = strcasecmp(nameA, nameB);
+    return ret != 0 ? ret : strcmp(nameA, nameB);
 }
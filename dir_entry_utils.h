@@ -2,6 +2,8 @@
 #define _DIR_ENTRY_UTILS_H_INCLUDED_
 
 #include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
 
 #include "dir_listener.h"
 
@@ -31,43 +33,102 @@ char *truncateFileName(const char *fileName);
 int isHidden(const char *fileName);
 
 /**
- * 파일이 이미지 파일인지 확인
+ * 항목 이름 관련 정보 (이름 길이, 확장자 위치) 계산
+ * 목록 읽어들일 때 1회 호출 -> 정렬/Group 시 strrchr() 반복 호출 방지
  *
- * @param fileName 확인할 파일 이름 (null-terminated 문자열)
- * @return 이미지 파일이면 1, 그렇지 않으면 0
+ * @param entry 이름이 채워진 디렉토리 항목 (nameLen, extOffset 채워짐)
  *
  * @details
- * - 지원되는 이미지 확장자: `.jpg`, `.jpeg`, `.png`, `.gif`, `.bmp`
- * - 확장자는 대소문자를 구분하지 않음
+ * - 확장자: 마지막 '.'부터 끝까지
+ * - '.'으로 시작하는 이름의 첫 '.', 마지막 글자인 '.'은 확장자로 보지 않음
  */
-int isImageFile(const char *fileName);
+void fillNameInfo(DirEntry *entry);
 
 /**
- * 파일이 실행 파일인지 확인
+ * 디렉토리 항목 배열 정렬
  *
- * @param fileName 확인할 파일 이름 (null-terminated 문자열)
- * @return 실행 파일이면 1, 그렇지 않으면 0
+ * @param dirEntries 정렬할 디렉토리 항목 배열 (DirEntry 구조체 배열)
+ * @param sortKeys 정렬 Key 조합 (DIRLISTENER_SORTKEY_* 참조):
+ *               - 기준: `NAME`, `SIZE`, `DATE`, `EXT`, `TYPE`
+ *               - 방향: 각 Key별 `REVERSE` bit
+ * @param totalReadItems 정렬할 항목의 개수
  *
  * @details
- * - 지원되는 실행 파일 확장자: `.exe`, `.out`
- * - 확장자는 대소문자를 구분하지 않음
+ * - ".."는 항상 최상단, 폴더는 항상 파일보다 위
+ * - 1순위 Key부터 차례대로 비교, 모두 같으면 이름 기준으로 정렬
+ * - 항목이 없거나 배열이 NULL이면 동작하지 않음
+ * - 항목이 많으면 정렬 Worker Pool로 병렬 정렬 (parallelSort 참조)
  */
-int isEXE(const char *fileName);
+void applySorting(DirEntry *dirEntries, uint16_t sortKeys, size_t totalReadItems);
 
 /**
- * 디렉토리 항목 배열 정렬
+ * 정렬된 항목 배열에 항목 1개 삽입 (이진 탐색으로 위치 결정)
  *
- * @param dirEntries 정렬할 디렉토리 항목 배열 (DirEntry 구조체 배열)
- * @param flags 정렬 기준과 방향을 나타내는 비트 플래그:
- *               - 기준: `SORT_NAME`, `SORT_SIZE`, `SORT_DATE`
- *               - 방향: `SORT_ASCENDING`, `SORT_DESCENDING`
- * @param totalReadItems 정렬할 항목의 개수
+ * @param dirEntries 정렬된 디렉토리 항목 배열 (최소 (*totalItems + 1)개 공간 필요)
+ * @param totalItems (입출력) 배열의 항목 수: 삽입 후 1 증가
+ * @param newEntry 삽입할 항목
+ * @param sortKeys 배열 정렬에 사용된 Key 조합 (applySorting 참조)
+ * @return 삽입된 위치의 Index
+ */
+size_t insertSortedEntry(DirEntry *dirEntries, size_t *totalItems, const DirEntry *newEntry, uint16_t sortKeys);
+
+/**
+ * 정렬된 항목 배열에서 항목 1개 삭제 (나머지 항목 순서 유지)
+ *
+ * @param dirEntries 정렬된 디렉토리 항목 배열
+ * @param totalItems (입출력) 배열의 항목 수: 삭제 후 1 감소
+ * @param index 삭제할 항목의 Index
+ */
+void removeSortedEntry(DirEntry *dirEntries, size_t *totalItems, size_t index);
+
+/**
+ * 정렬된 항목 배열에 (정렬되지 않은) 여러 항목 병합
+ *
+ * @param dirEntries 정렬된 디렉토리 항목 배열 (최소 (*totalItems + deltaCnt)개 공간 필요)
+ * @param totalItems (입출력) 배열의 항목 수: 병합 후 deltaCnt만큼 증가
+ * @param delta 추가할 항목들 (주의: 함수 내부에서 정렬됨)
+ * @param deltaCnt 추가할 항목 수
+ * @param sortKeys 배열 정렬에 사용된 Key 조합 (applySorting 참조)
  *
  * @details
- * - 기준 플래그와 방향 플래그를 조합하여 정렬 수행
- * - 기준이 동일하면 이름 기준으로 정렬
- * - 항목이 없거나 배열이 NULL이면 동작하지 않음
+ * - delta만 정렬한 뒤, 기존 배열과 뒤쪽부터 merge-join: 전체 재정렬 불필요
+ * - 1개만 추가하는 경우, insertSortedEntry()와 같음
+ */
+void mergeSortedEntries(DirEntry *dirEntries, size_t *totalItems, DirEntry *delta, size_t deltaCnt, uint16_t sortKeys);
+
+/**
+ * 확장자별 항목 수, 크기 합계 계산
+ *
+ * @param dirEntries 디렉토리 항목 배열 (extOffset 계산된 상태)
+ * @param totalItems 항목 수
+ * @param groups (반환) 확장자별 통계 (최소 totalItems개 공간 필요)
+ * @return Group 수
+ *
+ * @details
+ * - 확장자는 대소문자 구분 없이 묶음 (소문자로 저장)
+ * - 폴더는 "/" Group으로 묶음 (크기 합계 X), ".."는 제외
+ * - 결과는 확장자 이름순 정렬
+ */
+size_t groupByExtension(const DirEntry *dirEntries, size_t totalItems, ExtGroup *groups);
+
+/**
+ * 이름순 (대소문자 구분 X) Index 생성: 이름 앞부분으로 항목 찾을 때 사용
+ *
+ * @param dirEntries 디렉토리 항목 배열 (정렬 기준 무관)
+ * @param totalItems 항목 수
+ * @param nameIndex (반환) 이름순으로 나열한 항목 Index (최소 totalItems개 공간 필요)
+ */
+void buildNameIndex(const DirEntry *dirEntries, size_t totalItems, uint16_t *nameIndex);
+
+/**
+ * 이름이 prefix로 시작하는 (이름순으로) 첫 항목 찾기 (이진 탐색)
+ *
+ * @param dirEntries 디렉토리 항목 배열
+ * @param nameIndex buildNameIndex()로 만든 이름 Index
+ * @param totalItems 항목 수
+ * @param prefix 찾을 이름 앞부분 (대소문자 구분 X)
+ * @return 찾음: dirEntries에서의 Index, 없음: -1
  */
-void applySorting(DirEntry *dirEntries, uint16_t flags, size_t totalReadItems);
+ssize_t findByNamePrefix(const DirEntry *dirEntries, const uint16_t *nameIndex, size_t totalItems, const char *prefix);
 
 #endif
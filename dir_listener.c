@@ -4,18 +4,36 @@
 #include <fcntl.h>
 #include <pthread.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include "commons.h"
 #include "config.h"
 #include "dir_entry_utils.h"
 #include "dir_listener.h"
+#include "file_class.h"
 #include "thread_commons.h"
+#include "trace.h"
+
+#define ENTRY_HASH_BITS 11  // 항목 이름 Hash Table 크기 (2^n)
+#define ENTRY_HASH_SIZE (1 << ENTRY_HASH_BITS)
+_Static_assert(ENTRY_HASH_SIZE >= 2 * MAX_DIR_ENTRIES, "ENTRY_HASH_SIZE must be at least 2 * MAX_DIR_ENTRIES");
+
 
 static unsigned int threadCnt = 0;  // 생성된 Thread 개수
 extern int directoryOpenArgs;  // main.c 참조
 
+/**
+ * (Thread의 onInit 함수) Trace에 표시할 Thread 이름 등록
+ *
+ * @param argsPtr thread의 runtime 정보 (사용 X)
+ * @return 0
+ */
+static int initDirListener(void *argsPtr);
+
 /**
  * (Thread의 loop 함수) 폴더 정보 반복해서 가져옴
  *
@@ -35,14 +53,69 @@ static int dirListener(void *argsPtr);
  */
 static ssize_t listEntries(DIR *dirToList, DirEntry *dirEntry, size_t bufLen);
 
+/**
+ * 새로 읽어들인 항목들을 정렬된 결과 Buffer에 반영
+ * 정렬 기준이 바뀌지 않았으면, 추가/삭제/변경된 항목만 반영 (전체 재정렬 X)
+ *
+ * @param args thread의 runtime 정보 (주의: bufMutex 획득된 상태에서 호출)
+ * @param readItems args->scanEntries에 읽어들인 항목 수
+ * @param sortKeys 정렬 Key 조합
+ * @return 목록 바뀜: true, 이전과 같음: false
+ */
+static bool applyScanResult(DirListenerArgs *args, size_t readItems, uint16_t sortKeys);
+
+/**
+ * 두 항목의 stat 정보 중 표시/정렬에 쓰이는 값들이 같은지 확인
+ *
+ * @param a 첫 번째 stat 정보
+ * @param b 두 번째 stat 정보
+ * @return 같으면: true, 다르면: false
+ */
+static inline bool isSameStat(const struct stat *a, const struct stat *b);
+
+/**
+ * 항목 이름 Hash (FNV-1a)
+ *
+ * @param name 항목 이름 (null-terminated 문자열)
+ * @return Hash 값
+ */
+static inline uint32_t hashEntryName(const char *name);
+
+/**
+ * 새 항목 번호 부여 (화면 쪽 Render Cache의 Key: 번호 같으면 표시 내용 같음)
+ *
+ * @param args Listener의 공유 변수
+ * @param entry 번호를 부여할 항목
+ */
+static inline void assignEntryId(DirListenerArgs *args, DirEntry *entry);
+
+/**
+ * 열린 폴더의 절대 경로 확인 (/proc/self/fd 이용)
+ *
+ * @param dir 경로 확인할 폴더
+ * @param pathBuf (반환) 경로 저장할 공간
+ * @param bufLen pathBuf 크기
+ * @return 성공: (경로 길이), 실패: -1
+ */
+static ssize_t resolveDirPath(DIR *dir, char *pathBuf, size_t bufLen);
+
+/**
+ * 창 선택 상태, 평균 갱신 시간으로 새로고침 간격 계산 (statusMutex 획득한 상태에서 호출)
+ *
+ * @param args Listener의 공유 변수
+ * @return 새로고침 간격 [단위: μs]
+ */
+static uint64_t calcRefreshInterval(DirListenerArgs *args);
+
 /**
  * 디렉터리 변경
  *
  * @param dir currentDir 변수 (해당 디렉터리에서 relative하게 탐색, 해당 변수에 새 directory 저장)
+ * @param baseFd 이동할 디렉터리명의 기준 폴더 (-1: dir 기준)
  * @param dirToMove 이동할 디렉터리명
  * @return 성공: 0, 실패: -1
  */
-int changeDir(DIR **dir, char *dirToMove);
+static int changeDir(DIR **dir, int baseFd, const char *dirToMove);
 
 /**
  * (Thread의 finish 함수) 종료 직전, 열려 있는 currentDir 닫음
@@ -59,8 +132,9 @@ int startDirListender(
 ) {
     if (threadCnt >= MAX_DIRWINS)
         return -1;
+    args->commonArgs.mainTask.mode = THREAD_SCHED_FIXED_DELAY;  // 간격: 목록 읽기 끝난 뒤부터 (Backoff와 함께: 오래 걸리는 폴더도 쉬는 시간 보장)
     if (startThread(
-            newThread, NULL, dirListener, closeCurrentDir,
+            newThread, initDirListener, dirListener, closeCurrentDir,
             DIR_INTERVAL_USEC, &args->commonArgs, args
         ) == -1) {
         return -1;
@@ -68,47 +142,251 @@ int startDirListender(
     return ++threadCnt;
 }
 
+int initDirListener(void *argsPtr) {
+    traceThreadName("listener");
+    return 0;
+}
+
 int dirListener(void *argsPtr) {
     DirListenerArgs *args = (DirListenerArgs *)argsPtr;
     ssize_t readItems;
     bool changeDirRequested = false;
+    bool isDirChanged = false;  // 이번에 폴더 바뀜 (dirFd 다시 게시 필요)
+    bool groupRequested;
+    uint16_t sortKeys;
+    char newCwdPath[PATH_MAX];  // 이동할 경로 (요청 시점의 값 복사)
+    int newCwdBaseFd = -1;  // 이동할 경로의 기준 폴더 (-1: 현재 폴더)
+    char pathBuf[PATH_MAX];  // 새로 확인한 현재 폴더 경로
+    ssize_t pathLen = -1;  // 새로 확인한 경로의 길이 (-1: 변경 없음)
+    uint64_t scanStartUSec = getMonotonicUSec();  // 갱신 시작 시간 (Backoff 계산용)
 
     // 폴더 변경 요청 확인
     pthread_mutex_lock(&args->commonArgs.statusMutex);  // 상태 Flag 보호 Mutex 획득
     if (args->commonArgs.statusFlags & DIRLISTENER_FLAG_CHANGE_DIR) {
         changeDirRequested = true;
         args->commonArgs.statusFlags &= ~DIRLISTENER_FLAG_CHANGE_DIR;
+        strcpy(newCwdPath, args->newCwdPath);
+        newCwdBaseFd = args->newCwdBaseFd;
+        args->newCwdBaseFd = -1;
     }
+    groupRequested = args->commonArgs.statusFlags & DIRLISTENER_FLAG_GROUP_EXT;
+    sortKeys = args->sortKeys;
     pthread_mutex_unlock(&args->commonArgs.statusMutex);  // 상태 Flag 보호 Mutex 해제
 
+    // 이하 파일 시스템 호출: 멈춘 파일 시스템 (NFS, FUSE 등)이면 오래 걸릴 수 있음 -> 시작 시간 기록 (Watchdog)
+    __atomic_store_n(&args->fsCallStartUSec, getMonotonicUSec(), __ATOMIC_RELAXED);
+
     // 폴더 변경 처리
-    pthread_mutex_lock(&args->dirMutex);  // 현재 Directory 보호 Mutex 획득
+    lockMutex(&args->dirMutex);  // 현재 Directory 보호 Mutex 획득
     if (changeDirRequested) {
-        if (changeDir(&args->currentDir, args->newCwdPath) == -1) {
+        if (changeDir(&args->currentDir, newCwdBaseFd, newCwdPath) == -1) {
             pthread_mutex_lock(&args->commonArgs.statusMutex);
             args->commonArgs.statusFlags |= DIRLISTENER_FLAG_CHDIR_FAIL;
             pthread_mutex_unlock(&args->commonArgs.statusMutex);
+            notifyUi(UI_WAKE_DATA);  // 오류 표시 필요
+        } else {
+            args->isSorted = false;  // 다른 폴더: 이전 목록과 비교 무의미
+            args->hasCwdPath = false;
+            isDirChanged = true;
         }
+        if (newCwdBaseFd != -1)
+            close(newCwdBaseFd);
+    }
+    if (!args->hasCwdPath) {  // 처음 or 폴더 바뀜: 경로 확인 (이외에는 다시 확인 X)
+        pathLen = resolveDirPath(args->currentDir, pathBuf, sizeof(pathBuf));
+        if (pathLen == -1)
+            pathLen = 0;  // 확인 실패: 경로 없음으로 게시
+        args->hasCwdPath = true;
+        isDirChanged = true;  // 처음: dirFd 게시 필요
     }
+    int newDirFd = isDirChanged ? fcntl(dirfd(args->currentDir), F_DUPFD_CLOEXEC, 0) : -1;  // 화면 쪽에 게시할 fd
 
-    // 현재 폴더 내용 가져옴
-    pthread_mutex_lock(&args->bufMutex);  // 결과값 보호 Mutex 획득
-    readItems = listEntries(args->currentDir, args->dirEntries, MAX_DIR_ENTRIES);  // 내용 가져오기
+    // 현재 폴더 내용 가져옴: Listener 전용 Buffer에 읽음 -> 결과값 보호 Mutex 불필요
+    TRACE_BEGIN(listStartUSec);
+    readItems = listEntries(args->currentDir, args->scanEntries, MAX_DIR_ENTRIES);  // 내용 가져오기
+    TRACE_END(listStartUSec, "listEntries");
     pthread_mutex_unlock(&args->dirMutex);  // 현재 Directory 보호 Mutex 해제
-    if (readItems == -1) {
-        pthread_mutex_unlock(&args->bufMutex);  // 결과값 보호 Mutex 해제
-        return -1;
-    }
-    if (readItems == 0)
-        readItems = 0;
-    args->totalReadItems = readItems;
 
-    applySorting(args->dirEntries, args->commonArgs.statusFlags, readItems);  // 불러온 목록 정렬
+    __atomic_store_n(&args->fsCallStartUSec, 0, __ATOMIC_RELAXED);  // 파일 시스템 호출 끝
+    if (readItems == -1 && !isDirChanged)
+        goto SCHEDULE_NEXT;
 
+    // 결과 반영
+    lockMutex(&args->bufMutex);  // 결과값 보호 Mutex 획득 (대기 시간: 통계에 기록)
+    bool isChanged;
+    if (readItems == -1) {  // 폴더 바뀌었는데 목록 읽기 실패: 이전 폴더 목록 남기면 안 됨 (다른 폴더의 이름으로 파일 작업됨)
+        args->totalReadItems = 0;
+        args->isSorted = false;
+        isChanged = true;
+    } else {
+        isChanged = applyScanResult(args, readItems, sortKeys);
+    }
+    if (isDirChanged) {  // 새 폴더: 목록과 함께 fd 게시
+        if (args->dirFd != -1)
+            close(args->dirFd);
+        args->dirFd = newDirFd;
+    }
+    if (pathLen != -1) {  // 새 경로: 목록과 함께 게시
+        memcpy(args->cwdPath, pathBuf, pathLen);
+        args->cwdPathLen = pathLen;
+        isChanged = true;
+    }
+    if (isChanged)
+        buildNameIndex(args->dirEntries, args->totalReadItems, args->nameIndex);  // 목록 바뀜: 이름 Index 다시 만듦
+    if (groupRequested && (isChanged || !args->hasExtGroups)) {  // Group 보기: 목록 바뀐 경우만 다시 계산
+        args->totalExtGroups = groupByExtension(args->dirEntries, args->totalReadItems, args->extGroups);
+        isChanged = true;
+    }
+    args->hasExtGroups = groupRequested;
+    if (isChanged)
+        args->generation++;  // 화면 쪽: 다시 그려야 함
     pthread_mutex_unlock(&args->bufMutex);  // 결과값 보호 Mutex 해제
+    if (isChanged)
+        notifyUi(UI_WAKE_DATA);
+
+SCHEDULE_NEXT:
+    // 다음 갱신 간격: 이번 갱신 시간 반영 (지수 이동 평균: 한 번 느린 갱신으로 간격 급변 방지)
+    uint64_t scanUSec = getMonotonicUSec() - scanStartUSec;
+    pthread_mutex_lock(&args->commonArgs.statusMutex);
+    args->scanCostUSec = (args->scanCostUSec * 3 + scanUSec) / 4;
+    args->commonArgs.mainTask.interval = calcRefreshInterval(args);
+    pthread_mutex_unlock(&args->commonArgs.statusMutex);
     return readItems;
 }
 
+void setListenerFocus(DirListenerArgs *args, bool isFocused) {
+    if (args->isFocused == isFocused)  // Main Thread만 변경 -> Mutex 없이 읽어도 됨
+        return;
+    pthread_mutex_lock(&args->commonArgs.statusMutex);
+    args->isFocused = isFocused;
+    args->commonArgs.mainTask.interval = calcRefreshInterval(args);
+    if (isFocused)
+        pthread_cond_signal(&args->commonArgs.resumeThread);  // 새로 선택됨: 바로 갱신 (보이는 창만 선택됨 -> 일시정지된 Listener 깨우지 않음)
+    pthread_mutex_unlock(&args->commonArgs.statusMutex);
+}
+
+uint64_t calcRefreshInterval(DirListenerArgs *args) {
+    uint64_t interval = args->isFocused ? DIR_INTERVAL_USEC : DIR_UNFOCUSED_INTERVAL_USEC;
+    uint64_t backoff = args->scanCostUSec * DIR_BACKOFF_FACTOR;
+
+    if (backoff > interval)
+        interval = backoff;
+    if (interval > DIR_MAX_INTERVAL_USEC)
+        interval = DIR_MAX_INTERVAL_USEC;
+    return interval;
+}
+
+int dupListenerDirFd(DirListenerArgs *args) {
+    int fd = -1;
+    pthread_mutex_lock(&args->bufMutex);  // Listener는 bufMutex 잡은 채로 파일 시스템 호출 X -> 오래 대기하지 않음
+    if (args->dirFd != -1)
+        fd = fcntl(args->dirFd, F_DUPFD_CLOEXEC, 0);
+    pthread_mutex_unlock(&args->bufMutex);
+    return fd;
+}
+
+bool isListenerUnresponsive(DirListenerArgs *args) {
+    uint64_t startUSec = __atomic_load_n(&args->fsCallStartUSec, __ATOMIC_RELAXED);
+    return startUSec != 0 && getMonotonicUSec() - startUSec > FS_WATCHDOG_USEC;
+}
+
+bool applyScanResult(DirListenerArgs *args, size_t readItems, uint16_t sortKeys) {
+    // 정렬 기준 변경 or 폴더 변경: 전체 재정렬
+    if (!args->isSorted || args->sortedKeys != sortKeys) {
+        for (size_t i = 0; i < readItems; i++)
+            assignEntryId(args, &args->scanEntries[i]);
+        memcpy(args->dirEntries, args->scanEntries, readItems * sizeof(DirEntry));
+        args->totalReadItems = readItems;
+        if (readItems > 0) {
+            TRACE_BEGIN(sortStartUSec);
+            applySorting(args->dirEntries, sortKeys, readItems);  // 불러온 목록 정렬
+            TRACE_END(sortStartUSec, "applySorting");
+        }
+        args->sortedKeys = sortKeys;
+        args->isSorted = true;
+        return true;
+    }
+
+    // 기존 항목들의 이름 -> Index Hash Table 생성 (Open addressing, Linear probing)
+    int32_t hashTable[ENTRY_HASH_SIZE];  // 기존 항목의 Index (-1: 빈 칸)
+    bool isKept[MAX_DIR_ENTRIES];  // 기존 항목이 변경 없이 남아 있는지
+    uint32_t slot;
+    memset(hashTable, -1, sizeof(hashTable));
+    for (size_t i = 0; i < args->totalReadItems; i++) {
+        for (slot = hashEntryName(args->dirEntries[i].entryName) & (ENTRY_HASH_SIZE - 1); hashTable[slot] != -1; slot = (slot + 1) & (ENTRY_HASH_SIZE - 1));
+        hashTable[slot] = i;
+        isKept[i] = false;
+    }
+
+    // 새 목록의 각 항목: 기존에 같은 항목 있으면 유지, 없거나 바뀌었으면 delta로 모음
+    size_t keptCnt = 0;  // 변경 없이 남은 기존 항목 수
+    size_t deltaCnt = 0;  // 추가/변경된 항목 수 (scanEntries 앞쪽에 모음: deltaCnt <= i 이므로 덮어써도 안전)
+    int32_t oldIdx;
+    for (size_t i = 0; i < readItems; i++) {
+        DirEntry *entry = &args->scanEntries[i];
+        for (slot = hashEntryName(entry->entryName) & (ENTRY_HASH_SIZE - 1); (oldIdx = hashTable[slot]) != -1; slot = (slot + 1) & (ENTRY_HASH_SIZE - 1)) {
+            if (strcmp(args->dirEntries[oldIdx].entryName, entry->entryName) == 0)
+                break;
+        }
+        if (oldIdx != -1 && isSameStat(&args->dirEntries[oldIdx].statEntry, &entry->statEntry)) {
+            isKept[oldIdx] = true;  // 변경 없음
+            keptCnt++;
+        } else {  // 새 항목 or 변경된 항목
+            assignEntryId(args, entry);
+            if (deltaCnt != i)
+                args->scanEntries[deltaCnt] = *entry;
+            deltaCnt++;
+        }
+    }
+
+    // 삭제/변경된 기존 항목 제거 (순서 유지 -> 정렬 상태 유지)
+    size_t removedCnt = args->totalReadItems - keptCnt;
+    if (removedCnt == 1) {  // 1개: 해당 위치만 당김
+        size_t i;
+        for (i = 0; i < args->totalReadItems && isKept[i]; i++);
+        removeSortedEntry(args->dirEntries, &args->totalReadItems, i);
+    } else if (removedCnt > 1) {  // 여러 개: 한 번에 Compaction
+        keptCnt = 0;
+        for (size_t i = 0; i < args->totalReadItems; i++) {
+            if (!isKept[i])
+                continue;
+            if (keptCnt != i)
+                args->dirEntries[keptCnt] = args->dirEntries[i];
+            keptCnt++;
+        }
+        args->totalReadItems = keptCnt;
+    }
+
+    // 추가/변경된 항목 병합
+    mergeSortedEntries(args->dirEntries, &args->totalReadItems, args->scanEntries, deltaCnt, sortKeys);
+    return removedCnt > 0 || deltaCnt > 0;
+}
+
+bool isSameStat(const struct stat *a, const struct stat *b) {
+    return a->st_ino == b->st_ino
+           && a->st_mode == b->st_mode
+           && a->st_size == b->st_size
+           && a->st_mtim.tv_sec == b->st_mtim.tv_sec
+           && a->st_mtim.tv_nsec == b->st_mtim.tv_nsec
+           && a->st_ctim.tv_sec == b->st_ctim.tv_sec
+           && a->st_ctim.tv_nsec == b->st_ctim.tv_nsec;
+}
+
+void assignEntryId(DirListenerArgs *args, DirEntry *entry) {
+    if (++args->lastEntryId == 0)  // 0: '미부여' 용도로 남겨둠
+        args->lastEntryId = 1;
+    entry->entryId = args->lastEntryId;
+}
+
+uint32_t hashEntryName(const char *name) {
+    uint32_t hash = 2166136261u;  // FNV offset basis
+    for (; *name != '\0'; name++) {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;  // FNV prime
+    }
+    return hash;
+}
+
 ssize_t listEntries(DIR *dirToList, DirEntry *dirEntries, size_t bufLen) {
     size_t readItems = 0;
     int fdDir = dirfd(dirToList);
@@ -127,9 +405,11 @@ ssize_t listEntries(DIR *dirToList, DirEntry *dirEntries, size_t bufLen) {
         }
         strncpy(dirEntries[readItems].entryName, ent->d_name, NAME_MAX);  // 이름 복사
         dirEntries[readItems].entryName[NAME_MAX] = '\0';  // 끝에 null 문자 추가: 파일 이름 매우 긴 경우, strncpy()는 끝에 null문자 쓰지 않을 수도 있음
+        fillNameInfo(&dirEntries[readItems]);  // 이름 길이, 확장자 위치 미리 계산
         if (fstatat(fdDir, ent->d_name, &(dirEntries[readItems].statEntry), AT_SYMLINK_NOFOLLOW) == -1) {  // stat 읽어들임
             return -1;
         }
+        dirEntries[readItems].colorPair = classifyEntry(&dirEntries[readItems]);  // 색상 미리 결정: 출력 시 확장자 비교 X
         errno = 0;
         readItems++;
     }
@@ -138,12 +418,22 @@ ssize_t listEntries(DIR *dirToList, DirEntry *dirEntries, size_t bufLen) {
     return readItems;
 }
 
-int changeDir(DIR **dir, char *dirToMove) {
+ssize_t resolveDirPath(DIR *dir, char *pathBuf, size_t bufLen) {
+    char linkPath[32];  // "/proc/self/fd/N"
+    int fdDir = dirfd(dir);
+    if (fdDir == -1)
+        return -1;
+    snprintf(linkPath, sizeof(linkPath), "/proc/self/fd/%d", fdDir);
+    ssize_t pathLen = readlink(linkPath, pathBuf, bufLen);
+    return pathLen == bufLen ? -1 : pathLen;  // Buffer 가득 참: 잘렸을 수 있음
+}
+
+int changeDir(DIR **dir, int baseFd, const char *dirToMove) {
     DIR *currentDir = *dir;
 
     // 전달받은 currentDirent의, 내부적으로 사용되는 file descriptor 받아옴
     // (주의: 이 파일 descriptor 자체를 close()하면 안 됨: closedir()할 때 같이 닫힘)
-    int fdDir = dirfd(currentDir);
+    int fdDir = baseFd != -1 ? baseFd : dirfd(currentDir);
     if (fdDir == -1)  // 실패 시 -> -1 리턴, 종료
         return -1;
 
@@ -3,7 +3,9 @@
 
 #include <dirent.h>
 #include <pthread.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <sys/stat.h>
 
 #include "config.h"
@@ -12,14 +14,27 @@
 
 #define DIRLISTENER_FLAG_CHANGE_DIR (1 << (THREAD_FLAG_MSB + 1))  // 디렉터리 변경 요청
 
-#define DIRLISTENER_FLAG_SORT_NAME (0b00 << (THREAD_FLAG_MSB + 2))  // 정렬 기준: 이름
-#define DIRLISTENER_FLAG_SORT_SIZE (0b01 << (THREAD_FLAG_MSB + 2))  // 정렬 기준: 크기
-#define DIRLISTENER_FLAG_SORT_DATE (0b10 << (THREAD_FLAG_MSB + 2))  // 정렬 기준: 날짜
-#define DIRLISTENER_FLAG_SORT_CRITERION_MASK (0b11 << (THREAD_FLAG_MSB + 2))  // 정렬 기준 마스크
-#define DIRLISTENER_FLAG_SORT_REVERSE (1 << (THREAD_FLAG_MSB + 4))  // 내림차순 정렬
+#define DIRLISTENER_FLAG_GROUP_EXT (1 << (THREAD_FLAG_MSB + 2))  // 확장자별 Group 정보 계산 요청
 
 #define DIRLISTENER_FLAG_CHDIR_FAIL (1 << (THREAD_FLAG_MSB + 5))  // 폴더 변경 실패
 
+// 정렬 Key: 4-bit 단위로 최대 DIRLISTENER_MAX_SORT_KEYS개 조합 (하위 4-bit부터 1순위, 2순위, ...)
+#define DIRLISTENER_SORTKEY_NONE 0x0  // Key 없음 (목록 끝)
+#define DIRLISTENER_SORTKEY_NAME 0x1  // 정렬 기준: 이름
+#define DIRLISTENER_SORTKEY_SIZE 0x2  // 정렬 기준: 크기
+#define DIRLISTENER_SORTKEY_DATE 0x3  // 정렬 기준: 날짜
+#define DIRLISTENER_SORTKEY_EXT 0x4  // 정렬 기준: 확장자 (대소문자 구분 X)
+#define DIRLISTENER_SORTKEY_TYPE 0x5  // 정렬 기준: 파일 종류
+#define DIRLISTENER_SORTKEY_CRITERION_MASK 0x7  // 정렬 기준 마스크
+#define DIRLISTENER_SORTKEY_REVERSE 0x8  // 내림차순 정렬
+#define DIRLISTENER_SORTKEY_BITS 4  // Key 1개의 크기
+#define DIRLISTENER_SORTKEY_MASK 0xF  // Key 1개의 마스크
+#define DIRLISTENER_MAX_SORT_KEYS 4  // 최대 Key 수 (uint16_t에 저장)
+
+#define DIRLISTENER_SORTKEY_GET(keys, i) (((keys) >> ((i) * DIRLISTENER_SORTKEY_BITS)) & DIRLISTENER_SORTKEY_MASK)  // i순위 Key 가져오기
+
+#define MAX_EXT_LEN 15  // 확장자 Group에 저장되는 최대 확장자 길이 ('.' 포함)
+
 
 /**
  * @struct _DirEntry
@@ -27,21 +42,58 @@
  *
  * @var _DirEntry::entryName 파일/디렉토리 이름 (최대 NAME_MAX 길이)
  * @var _DirEntry::statEntry 파일/디렉토리의 stat 정보
+ * @var _DirEntry::nameLen 이름 길이
+ * @var _DirEntry::extOffset 확장자('.' 포함) 시작 위치 (확장자 없으면: nameLen)
+ * @var _DirEntry::colorPair 표시 색상 Pair (목록 읽어들일 때 결정)
+ * @var _DirEntry::entryId 항목 번호 (새 항목 or 정보 바뀐 항목마다 새로 부여, 0: 미부여)
  */
 struct _DirEntry {
     char entryName[NAME_MAX + 1];  // 파일/디렉토리 이름
     struct stat statEntry;  // 파일/디렉토리의 stat 정보
+    uint16_t nameLen;  // 이름 길이
+    uint16_t extOffset;  // 확장자('.' 포함) 시작 위치 (확장자 없으면: nameLen)
+    uint8_t colorPair;  // 표시 색상 Pair (목록 읽어들일 때 결정)
+    uint32_t entryId;  // 항목 번호 (새 항목 or 정보 바뀐 항목마다 새로 부여, 0: 미부여)
 };
 typedef struct _DirEntry DirEntry;
 
+/**
+ * @struct _ExtGroup
+ * 확장자별 항목 통계
+ *
+ * @var _ExtGroup::ext 확장자 (소문자, '.' 포함) / 빈 문자열: 확장자 없음 / "/": 폴더
+ * @var _ExtGroup::count 항목 수
+ * @var _ExtGroup::totalBytes 항목 크기 합계
+ */
+typedef struct _ExtGroup {
+    char ext[MAX_EXT_LEN + 1];  // 확장자
+    size_t count;  // 항목 수
+    off_t totalBytes;  // 항목 크기 합계
+} ExtGroup;
+
 /**
  * @struct _DirListenerArgs
  *
  * @var _DirListenerArgs::commonArgs Thread들 공통 공유 변수
- * @var _DirListenerArgs::newCwdPath 새 working directory의 (relative) path
+ * @var _DirListenerArgs::newCwdPath 새 working directory의 (relative) path (statusMutex로 보호)
+ * @var _DirListenerArgs::newCwdBaseFd newCwdPath의 기준 폴더 fd (statusMutex로 보호, -1: 현재 폴더 기준, Listener가 close)
+ * @var _DirListenerArgs::dirFd 현재 폴더 fd의 복사본 (목록과 함께 게시, bufMutex로 보호, -1: 아직 없음)
+ * @var _DirListenerArgs::fsCallStartUSec 진행 중인 파일 시스템 호출의 시작 시간 (Atomic 접근, 0: 호출 중 아님)
+ * @var _DirListenerArgs::isFocused 선택된 창의 Listener인지 (statusMutex로 보호, Main Thread만 변경: setListenerFocus())
+ * @var _DirListenerArgs::scanCostUSec 1회 갱신에 걸리는 평균 시간 (지수 이동 평균, statusMutex로 보호)
  * @var _DirListenerArgs::statBuf 읽어들인 항목들의 stat 결과
  * @var _DirListenerArgs::nameBuf 읽어들인 항목들의 이름
  * @var _DirListenerArgs::totalReadItems 총 읽어들인 개수
+ * @var _DirListenerArgs::extGroups 확장자별 통계 (DIRLISTENER_FLAG_GROUP_EXT 설정된 경우에만 갱신)
+ * @var _DirListenerArgs::totalExtGroups 확장자 Group 수
+ * @var _DirListenerArgs::cwdPath 현재 폴더의 절대 경로 (폴더 바뀔 때만 다시 확인)
+ * @var _DirListenerArgs::cwdPathLen cwdPath의 길이 (0: 확인 실패)
+ * @var _DirListenerArgs::nameIndex 이름순 (대소문자 구분 X) 항목 Index: 이름 앞부분으로 이동할 때 이진 탐색
+ * @var _DirListenerArgs::sortKeys 정렬 Key 조합 (statusMutex로 보호)
+ * @var _DirListenerArgs::scanEntries 새로 읽어들인 항목들 (Listener Thread 전용 임시 Buffer)
+ * @var _DirListenerArgs::sortedKeys dirEntries 정렬에 사용된 Key 조합 (Listener Thread 전용)
+ * @var _DirListenerArgs::isSorted dirEntries가 sortedKeys 기준으로 정렬된 상태인지 여부 (Listener Thread 전용)
+ * @var _DirListenerArgs::hasCwdPath cwdPath가 currentDir 기준으로 확인된 상태인지 (dirMutex로 보호: currentDir 바꾸면 false로)
  * @var _DirListenerArgs::bufMutex 결과값 보호 Mutex
  * @var _DirListenerArgs::dirMutex currentDir 보호 Mutex
  */
@@ -49,13 +101,34 @@ typedef struct _DirListenerArgs {
     ThreadArgs commonArgs;  // Thread들 공통 공유 변수
     // 상태 관련
     char newCwdPath[PATH_MAX];  // 새 working directory의 (relative) path
+    int newCwdBaseFd;  // newCwdPath의 기준 폴더 fd (-1: 현재 폴더 기준)
     DIR *currentDir;  // 현재 working directory (경고: 초기 Directory 설정 용도로만 접근, 이외 용도로 접근 금지!)
+    bool hasCwdPath;  // cwdPath가 currentDir 기준으로 확인된 상태인지 (dirMutex로 보호)
     // 결과 Buffer
     DirEntry dirEntries[MAX_DIR_ENTRIES];
     size_t totalReadItems;  // 총 읽어들인 개수
+    ExtGroup extGroups[MAX_DIR_ENTRIES];  // 확장자별 통계
+    size_t totalExtGroups;  // 확장자 Group 수
+    uint16_t nameIndex[MAX_DIR_ENTRIES];  // 이름순 항목 Index
+    char cwdPath[PATH_MAX];  // 현재 폴더의 절대 경로
+    size_t cwdPathLen;  // cwdPath의 길이 (0: 확인 실패)
+    uint64_t generation;  // 결과 Buffer 변경 횟수 (같으면: 내용 같음 -> 다시 그릴 필요 X)
+    int dirFd;  // 현재 폴더 fd의 복사본 (목록의 이름들이 가리키는 폴더)
+    // Watchdog
+    uint64_t fsCallStartUSec;  // 진행 중인 파일 시스템 호출의 시작 시간 (0: 호출 중 아님)
+    // 정렬 기준, 갱신 주기 (statusMutex로 보호)
+    uint16_t sortKeys;  // 정렬 Key 조합
+    bool isFocused;  // 선택된 창의 Listener인지
+    uint64_t scanCostUSec;  // 1회 갱신에 걸리는 평균 시간
+    // 정렬 상태 (Listener Thread 전용: 별도 보호 불필요)
+    DirEntry scanEntries[MAX_DIR_ENTRIES];  // 새로 읽어들인 항목들 (임시 Buffer)
+    uint16_t sortedKeys;  // dirEntries 정렬에 사용된 Key 조합
+    bool isSorted;  // dirEntries가 sortedKeys 기준으로 정렬된 상태인지 (false: 다음 갱신 시 전체 재정렬)
+    uint32_t lastEntryId;  // 마지막으로 부여한 항목 번호
+    bool hasExtGroups;  // extGroups가 현재 목록 기준으로 계산된 상태인지
     // Mutexes
     pthread_mutex_t bufMutex;  // 결과값 보호 Mutex
-    pthread_mutex_t dirMutex;  // currentDir 보호 Mutex
+    pthread_mutex_t dirMutex;  // currentDir 보호 Mutex (Listener 내부 전용: 화면 쪽은 dirFd 사용)
 } DirListenerArgs;
 
 /**
@@ -70,4 +143,37 @@ int startDirListender(
     DirListenerArgs *args
 );
 
+/**
+ * 현재 게시된 목록의 폴더 fd 복사 (파일 작업 요청용)
+ *
+ * @param args Listener의 공유 변수
+ * @return 성공: 새 fd (호출한 쪽에서 close), 아직 게시 안 됨 or 실패: -1
+ *
+ * @details
+ * - 파일 시스템 호출 없음 (fd 복사만): 멈춘 파일 시스템에 있는 창이라도 대기하지 않음
+ */
+int dupListenerDirFd(DirListenerArgs *args);
+
+/**
+ * Listener가 파일 시스템 호출에서 `FS_WATCHDOG_USEC` 넘게 멈춰 있는지 확인
+ *
+ * @param args Listener의 공유 변수
+ * @return 멈춤: true, 정상 or 대기 중: false
+ */
+bool isListenerUnresponsive(DirListenerArgs *args);
+
+/**
+ * 창 선택 상태에 따라 Listener의 새로고침 간격 변경
+ *
+ * @param args Listener의 공유 변수
+ * @param isFocused 선택된 창의 Listener인지
+ *
+ * @details
+ * - 간격: 선택된 창 `DIR_INTERVAL_USEC`, 선택되지 않은 창 `DIR_UNFOCUSED_INTERVAL_USEC` (숨겨진 창: 일시정지)
+ * - 단, 평균 갱신 시간 * `DIR_BACKOFF_FACTOR` 이상 (최대 `DIR_MAX_INTERVAL_USEC`): 오래 걸리는 폴더는 덜 자주 갱신
+ * - 새로 선택됨: 바로 갱신 (대기 중인 Listener 깨움)
+ * - 상태 바뀐 경우에만 Mutex 획득 -> 매 Frame 호출 가능 (Main Thread에서만 호출)
+ */
+void setListenerFocus(DirListenerArgs *args, bool isFocused);
+
 #endif
@@ -5,6 +5,7 @@
 #include <pthread.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
@@ -12,12 +13,53 @@
 #include "colors.h"
 #include "commons.h"
 #include "config.h"
+#include "cursor_event.h"
 #include "dir_entry_utils.h"
 #include "dir_listener.h"
 #include "dir_window.h"
 #include "file_operator.h"
 
 
+/**
+ * @struct _RenderCacheLine
+ * 항목 1개의 출력 문자열 Cache
+ *
+ * @var _RenderCacheLine::entryId 항목 번호 (0: 빈 칸)
+ * @var _RenderCacheLine::winW 문자열 만들 때의 창 너비 (너비에 따라 표시 열 다름)
+ * @var _RenderCacheLine::row 출력할 문자열 (이름, 크기, 수정 시각)
+ */
+typedef struct _RenderCacheLine {
+    uint32_t entryId;  // 항목 번호 (0: 빈 칸)
+    int winW;  // 문자열 만들 때의 창 너비
+    char row[RENDER_ROW_LEN];  // 출력할 문자열
+} RenderCacheLine;
+
+/**
+ * @struct _DrawState
+ * 창에 마지막으로 그린 상태 (다음 Frame에서 바뀐 부분만 다시 그리기 위함)
+ *
+ * @var _DrawState::isValid 그린 적 있는지 (false: 전체 다시 그림)
+ * @var _DrawState::generation 그릴 때의 목록 변경 횟수
+ * @var _DrawState::startIdx 첫 줄에 표시한 항목 Index
+ * @var _DrawState::cursorLine 역상으로 표시한 줄 (-1: 없음)
+ * @var _DrawState::winH 창 높이
+ * @var _DrawState::winW 창 너비
+ * @var _DrawState::groupView Group 보기였는지
+ * @var _DrawState::sortKeys 헤더에 표시한 정렬 Key 조합
+ * @var _DrawState::isUnresponsive '응답 없음' 표시했는지
+ */
+typedef struct _DrawState {
+    bool isValid;  // 그린 적 있는지 (false: 전체 다시 그림)
+    uint64_t generation;  // 그릴 때의 목록 변경 횟수
+    size_t startIdx;  // 첫 줄에 표시한 항목 Index
+    int cursorLine;  // 역상으로 표시한 줄 (-1: 없음)
+    int winH;  // 창 높이
+    int winW;  // 창 너비
+    bool groupView;  // Group 보기였는지
+    uint16_t sortKeys;  // 헤더에 표시한 정렬 Key 조합
+    bool isUnresponsive;  // '응답 없음' 표시했는지
+} DrawState;
+
 /**
  * @struct _DirWin
  * Directory Window의 정보 저장
@@ -30,8 +72,17 @@
  * @var _DirWin::totalReadItems 현 폴더에서 읽어들인 항목 수
  *   일반적으로, 디렉토리에 있는 파일, 폴더의 수와 같음
  *   단, buffer 공간 부족한 경우, 최대 buffer 길이
- * @var _DirWin::lineMovementEvent 창별 줄 이동 Event 저장 (bit field)
- * @var _DirWin::sortFlag 정렬 관련 Flag들
+ * @var _DirWin::totalExtGroups 확장자 Group 수
+ * @var _DirWin::extGroups 확장자별 통계
+ * @var _DirWin::groupView '확장자별 Group 보기' 여부
+ * @var _DirWin::groupPos Group 보기에서 현재 선택된 Group
+ * @var _DirWin::nameIndex 이름순 항목 Index (bufMutex로 보호)
+ * @var _DirWin::cursorEvents 커서 이동 Event Queue (다음 갱신 때 한 번에 적용)
+ * @var _DirWin::sortKeys 정렬 Key 조합 (Listener에 전달한 값과 같음)
+ * @var _DirWin::renderCache 항목별로 미리 만든 출력 문자열 (Direct-mapped, Key: entryId)
+ * @var _DirWin::generation 항목/통계 변경 횟수 (bufMutex로 보호)
+ * @var _DirWin::isUnresponsive Listener가 파일 시스템 호출에서 멈춰 있는지
+ * @var _DirWin::drawn 마지막으로 그린 상태
  */
 struct _DirWin {
     WINDOW *win;  // WINDOW 구조체
@@ -40,8 +91,17 @@ struct _DirWin {
     pthread_mutex_t *bufMutex;  // dirEntry 보호 Mutex
     DirEntry *dirEntry;  // 폴더 항목들
     size_t *totalReadItems;  // 현 폴더에서 읽어들인 항목 수
-    uint64_t lineMovementEvent;  // 창별 줄 이동 Event 저장 (bit field)
-    uint8_t sortFlag;  // 정렬 관련 Flag들
+    size_t *totalExtGroups;  // 확장자 Group 수
+    ExtGroup *extGroups;  // 확장자별 통계
+    bool groupView;  // '확장자별 Group 보기' 여부
+    size_t groupPos;  // Group 보기에서 현재 선택된 Group
+    uint16_t *nameIndex;  // 이름순 항목 Index
+    CursorEventQueue cursorEvents;  // 커서 이동 Event Queue
+    uint16_t sortKeys;  // 정렬 Key 조합
+    RenderCacheLine renderCache[RENDER_CACHE_SIZE];  // 항목별로 미리 만든 출력 문자열
+    uint64_t *generation;  // 항목/통계 변경 횟수
+    bool isUnresponsive;  // Listener가 파일 시스템 호출에서 멈춰 있는지
+    DrawState drawn;  // 마지막으로 그린 상태
 };
 typedef struct _DirWin DirWin;
 
@@ -85,11 +145,91 @@ static void printFileHeader(DirWin *win, int winH, int winW);
  */
 static void printFileInfo(DirWin *win, int startIdx, int line, int winW);
 
+/**
+ * 디렉토리 항목 1줄의 출력 문자열 생성 (이름, 크기, 수정 시각)
+ *
+ * @param entry 출력할 항목
+ * @param winW 창의 너비 (너비에 따라 표시 열 다름)
+ * @param buf (반환) 출력 문자열
+ * @param bufLen buf의 크기
+ */
+static void formatFileRow(const DirEntry *entry, int winW, char *buf, size_t bufLen);
+
+/**
+ * 목록 1줄 출력 (일반 목록 or Group 보기)
+ *
+ * @param win 디렉토리 표시 창
+ * @param startIdx 출력 시작 인덱스
+ * @param line 출력할 줄 번호
+ * @param isSelected 선택된 줄인지 (역상으로 출력)
+ * @param winW 창의 너비
+ */
+static void printDirWinLine(DirWin *win, int startIdx, int line, bool isSelected, int winW);
+
+/**
+ * 쌓인 커서 이동 Event들을 합쳐 한 번에 적용 (bufMutex 획득한 상태에서 호출)
+ *
+ * @param win 디렉토리 표시 창
+ *
+ * @details
+ * - 한 화면 이동 크기: 창의 항목 출력 줄 수
+ * - 이름 앞부분으로 이동: 이름 Index에서 이진 탐색 (Group 보기, 못 찾음: 이동 X)
+ */
+static void applyCursorEvents(DirWin *win);
+
+/**
+ * 확장자 Group 보기의 상단 헤더 출력
+ *
+ * @param win 디렉토리 표시 창
+ * @param winW 창의 너비
+ */
+static void printGroupHeader(DirWin *win, int winW);
+
+/**
+ * 확장자 Group 정보 출력
+ *
+ * @param win 디렉토리 표시 창
+ * @param startIdx 출력 시작 인덱스
+ * @param line 출력할 줄 번호
+ * @param winW 창의 너비
+ */
+static void printGroupInfo(DirWin *win, int startIdx, int line, int winW);
+
+/**
+ * 정렬 Key 조합에서 특정 기준의 표시 문자열 생성
+ *
+ * @param sortKeys 정렬 Key 조합
+ * @param criterion 찾을 정렬 기준
+ * @param buf (반환) 표시 문자열: "v"(오름차순), "^"(내림차순) + (Key 2개 이상이면) 순위 / 해당 기준 없으면 빈 문자열
+ */
+static void getSortMarker(uint16_t sortKeys, int criterion, char *buf);
+
+/**
+ * 창 상단 테두리에 정렬 Key 조합 표시 (Key 2개 이상 or 열 없는 기준 사용 시)
+ *
+ * @param win 디렉토리 표시 창
+ * @param winW 창의 너비
+ */
+static void printSortSummary(DirWin *win, int winW);
+
+/**
+ * 창 하단 테두리에 '응답 없음' 표시 (Listener가 파일 시스템 호출에서 멈춘 경우)
+ *
+ * @param win 디렉토리 표시 창
+ * @param winH 창의 높이
+ * @param winW 창의 너비
+ */
+static void printUnresponsiveMark(DirWin *win, int winH, int winW);
+
 
 int initDirWin(
     pthread_mutex_t *bufMutex,
     size_t *totalReadItems,
-    DirEntry *dirEntry
+    DirEntry *dirEntry,
+    size_t *totalExtGroups,
+    ExtGroup *extGroups,
+    uint64_t *generation,
+    uint16_t *nameIndex
 ) {
     if (winCnt >= MAX_DIRWINS) {
         // 최대 창 개수 초과
@@ -122,8 +262,13 @@ int initDirWin(
         .currentPos = 0,
         .bufMutex = bufMutex,
         .totalReadItems = totalReadItems,
-        .sortFlag = 0x01,  // 기본 정렬 방식은 이름 오름차순
-        .dirEntry = dirEntry
+        .totalExtGroups = totalExtGroups,
+        .extGroups = extGroups,
+        .sortKeys = DIRLISTENER_SORTKEY_NAME,  // 기본 정렬 방식은 이름 오름차순
+        .dirEntry = dirEntry,
+        .generation = generation,
+        .nameIndex = nameIndex,
+        .drawn = { .isValid = false }
     };
     return winCnt++;
 }
@@ -135,11 +280,11 @@ int updateDirWins(void) {
     int screenH, screenW;
     int availableH;
     int ret;
-    int lineMovement;
     int centerLine, currentLine;
     int itemsToPrint;
     ssize_t itemsCnt;
     size_t startIdx;
+    size_t *pos;  // 현재 선택 위치 (일반 목록 or Group 보기)
     DirWin *win;
 
     getmaxyx(stdscr, screenH, screenW);
@@ -150,7 +295,6 @@ int updateDirWins(void) {
     }
 
     // 각 창들 업데이트
-    int eventStartPos;  // 이벤트 시작 위치
     int i;  // 내부 출력 for 문에서 사용할 변수
     for (int winNo = 0; winNo < showingWinCnt; winNo++) {
         win = windows + winNo;
@@ -172,71 +316,89 @@ int updateDirWins(void) {
         ret = pthread_mutex_trylock(win->bufMutex);
         if (ret != 0)
             continue;
-        itemsCnt = *win->totalReadItems;  // 읽어들인 개수 가져옴
+        // 읽어들인 개수, 선택 위치 가져옴 (Group 보기: Group 단위)
+        if (win->groupView) {
+            itemsCnt = *win->totalExtGroups;
+            pos = &win->groupPos;
+        } else {
+            itemsCnt = *win->totalReadItems;
+            pos = &win->currentPos;
+        }
 
         // 현재 선택이 범위 벗어난 경우 (파일 삭제 등으로 인한) -> 범위 안으로 보내기
-        if (win->currentPos >= itemsCnt - 1)
-            win->currentPos = itemsCnt - 1;
-
-        // 첫 Event의 위치 찾아내기: loop 끝나면, eventStartPos는 (event 수 * 2)에 해당하는 값 가짐 (매 event의 크기: 2-bit)
-        for (eventStartPos = 0; (win->lineMovementEvent & (UINT64_C(2) << eventStartPos)) != 0; eventStartPos += 2);
-
-        // 처음 event부터 선택 항목 이동 처리
-        while (eventStartPos > 0) {  // 남은 event 있는 동안
-            eventStartPos -= 2;  // 다음 event로 이동
-            lineMovement = (win->lineMovementEvent >> eventStartPos) & 0x03;  // 현 위치 event만 가져옴
-            switch (lineMovement) {
-                case 0x02:  // '한 칸 위로 이동' Event
-                    if (win->currentPos > 0)  // 위로 이동 가능하면
-                        win->currentPos--;
-                    else
-                        win->currentPos = 0;  // Corner case 처리: 최소 Index
-                    break;
-                case 0x03:  // '한 칸 아래로 이동' Event
-                    if (win->currentPos < itemsCnt - 1)  // 아래로 이동 가능하면
-                        win->currentPos++;
-                    else
-                        win->currentPos = itemsCnt - 1;  // Corner case 처리: 최대 Index
-                    break;
-            }
-        }
-        win->lineMovementEvent = 0;  // Event 모두 삭제
+        if (*pos >= itemsCnt - 1)
+            *pos = itemsCnt - 1;
 
-        availableH = winH - 4;  // 최대 출력 가능한 라인 넘버 -4
+        applyCursorEvents(win);  // 쌓인 커서 이동 처리
 
-        if (isColorSafe)
-            wbkgd(win->win, COLOR_PAIR(BGRND));  // 창 색깔 변경
-        printFileHeader(win, winH, winW);  // 최상단 Header 출력
+        availableH = winH - 4;  // 최대 출력 가능한 라인 넘버 -4
 
         // 라인 스크롤
         centerLine = (availableH - 1) / 2;  // 가운데 줄의 줄 번호 ( [0, availableH) )
         if (itemsCnt <= availableH) {  // 항목 개수 적음 -> 빠르게 처리
             startIdx = 0;
             itemsToPrint = itemsCnt;
-        } else if (win->currentPos < centerLine) {  // 위쪽 item 선택됨
+        } else if (*pos < centerLine) {  // 위쪽 item 선택됨
             startIdx = 0;
             itemsToPrint = itemsCnt < availableH ? itemsCnt : availableH;
-        } else if (win->currentPos >= itemsCnt - (availableH - centerLine - 1)) {  // 아래쪽 item 선택된 경우 (우변: 개수 - 커서 아래쪽에 출력될 item 수)
+        } else if (*pos >= itemsCnt - (availableH - centerLine - 1)) {  // 아래쪽 item 선택된 경우 (우변: 개수 - 커서 아래쪽에 출력될 item 수)
             startIdx = itemsCnt - availableH;
             itemsToPrint = availableH;
         } else {  // 일반적인 경우
-            startIdx = win->currentPos - centerLine;
+            startIdx = *pos - centerLine;
             itemsToPrint = availableH;
         }
 
-        currentLine = win->currentPos - startIdx;  // 역상으로 출력할, 현재 선택된 줄
-
-        // 디렉토리 출력
-        for (i = 0; i < itemsToPrint; i++) {  // 항목 있는 공간: 출력
-            if (winNo == currentWin && i == currentLine)  // 선택된 것: 역상으로 출력
-                wattron(win->win, A_REVERSE);
-            printFileInfo(win, startIdx, i, winW);
-            if (winNo == currentWin && i == currentLine)
-                wattroff(win->win, A_REVERSE);
+        currentLine = winNo == currentWin && itemsToPrint > 0 ? (int)(*pos - startIdx) : -1;  // 역상으로 출력할, 현재 선택된 줄 (-1: 선택된 창 아님)
+
+        if (
+            !win->drawn.isValid || changeWinSize
+            || win->drawn.generation != *win->generation
+            || win->drawn.startIdx != startIdx
+            || win->drawn.winH != winH || win->drawn.winW != winW
+            || win->drawn.groupView != win->groupView
+            || win->drawn.sortKeys != win->sortKeys
+            || win->drawn.isUnresponsive != win->isUnresponsive
+        ) {
+            // 내용/스크롤/크기 바뀜: 창 전체 다시 그림
+            if (isColorSafe)
+                wbkgd(win->win, COLOR_PAIR(BGRND));  // 창 색깔 변경
+            if (win->groupView)
+                printGroupHeader(win, winW);  // 최상단 Header 출력
+            else
+                printFileHeader(win, winH, winW);
+
+            // 디렉토리 출력
+            for (i = 0; i < itemsToPrint; i++)  // 항목 있는 공간: 출력
+                printDirWinLine(win, startIdx, i, i == currentLine, winW);
+            wmove(win->win, i + 3, 0);  // 커서 위치 이동, 이걸 넣어야 맨 아랫줄 공백을 wclrtobot로 안 지움
+            wclrtobot(win->win);  // 커서 아래 남는 공간: 지움
+        } else if (win->drawn.cursorLine != currentLine) {
+            // 커서만 이동 (or 창 선택 바뀜): 이전/현재 커서 줄만 다시 그림
+            if (win->drawn.cursorLine >= 0 && win->drawn.cursorLine < itemsToPrint)
+                printDirWinLine(win, startIdx, win->drawn.cursorLine, false, winW);
+            if (currentLine >= 0)
+                printDirWinLine(win, startIdx, currentLine, true, winW);
+        } else {
+            // 바뀐 것 없음: 창 건너뜀
+            pthread_mutex_unlock(win->bufMutex);
+            continue;
         }
-        wmove(win->win, i + 3, 0);  // 커서 위치 이동, 이걸 넣어야 맨 아랫줄 공백을 wclrtobot로 안 지움
-        wclrtobot(win->win);  // 커서 아래 남는 공간: 지움
-        box(win->win, 0, 0);
+        box(win->win, 0, 0);  // 긴 줄이 테두리 덮은 경우 대비
+        printSortSummary(win, winW);
+        printUnresponsiveMark(win, winH, winW);
+
+        win->drawn = (DrawState) {
+            .isValid = true,
+            .generation = *win->generation,
+            .startIdx = startIdx,
+            .cursorLine = currentLine,
+            .winH = winH,
+            .winW = winW,
+            .groupView = win->groupView,
+            .sortKeys = win->sortKeys,
+            .isUnresponsive = win->isUnresponsive
+        };
         pthread_mutex_unlock(win->bufMutex);
     }
     changeWinSize = false;
@@ -252,29 +414,13 @@ void printFileHeader(DirWin *win, int winH, int winW) {
 
     // 정렬 상태에 따른 헤더 출력 준비
     char nameHeader[30] = "    FILE NAME  ";
-    char sizeHeader[10] = "  SIZE  ";
-    char dateHeader[20] = "  LAST MODIFIED  ";
-
-    // 이름 정렬 상태 화살표
-    if (((win->sortFlag & SORT_NAME_MASK) >> SORT_NAME_SHIFT) == 1) {
-        strcat(nameHeader, "v");
-    } else if (((win->sortFlag & SORT_NAME_MASK) >> SORT_NAME_SHIFT) == 2) {
-        strcat(nameHeader, "^");
-    }
+    char sizeHeader[20] = "  SIZE  ";
+    char dateHeader[30] = "  LAST MODIFIED  ";
 
-    // 크기 정렬 상태 화살표
-    if (((win->sortFlag & SORT_SIZE_MASK) >> SORT_SIZE_SHIFT) == 1) {
-        strcat(sizeHeader, "v");
-    } else if (((win->sortFlag & SORT_SIZE_MASK) >> SORT_SIZE_SHIFT) == 2) {
-        strcat(sizeHeader, "^");
-    }
-
-    // 날짜 정렬 상태 화살표
-    if (((win->sortFlag & SORT_DATE_MASK) >> SORT_DATE_SHIFT) == 1) {
-        strcat(dateHeader, "v");
-    } else if (((win->sortFlag & SORT_DATE_MASK) >> SORT_DATE_SHIFT) == 2) {
-        strcat(dateHeader, "^");
-    }
+    // 정렬 상태 화살표 (Key 여러 개면 순위 포함)
+    getSortMarker(win->sortKeys, DIRLISTENER_SORTKEY_NAME, nameHeader + strlen(nameHeader));
+    getSortMarker(win->sortKeys, DIRLISTENER_SORTKEY_SIZE, sizeHeader + strlen(sizeHeader));
+    getSortMarker(win->sortKeys, DIRLISTENER_SORTKEY_DATE, dateHeader + strlen(dateHeader));
 
     // 헤더 출력 파트
     if (winW >= 54) {
@@ -299,13 +445,35 @@ void printFileHeader(DirWin *win, int winH, int winW) {
 
 // 파일 목록 출력 함수
 void printFileInfo(DirWin *win, int startIdx, int line, int winW) {
-    struct stat *fileStat = &(win->dirEntry[startIdx + line].statEntry);  // 파일 스테이터스
-    char *fileName = win->dirEntry[startIdx + line].entryName;  // 파일 이름
+    DirEntry *entry = &win->dirEntry[startIdx + line];
+    RenderCacheLine *cached = &win->renderCache[entry->entryId & (RENDER_CACHE_SIZE - 1)];
+    int displayLine = line + 3;  // 출력되는 실제 라인 넘버
+    int colorPair = entry->colorPair;  // 색상: 목록 읽어들일 때 결정됨
+
+    // Cache에 없거나 창 너비 바뀜: 문자열 새로 만듦
+    if (cached->entryId != entry->entryId || cached->winW != winW || entry->entryId == 0) {
+        formatFileRow(entry, winW, cached->row, sizeof(cached->row));
+        cached->entryId = entry->entryId;
+        cached->winW = winW;
+    }
+
+    // 색깔 적용
+    applyColor(win->win, colorPair);
+
+    // 출력 파트
+    mvwaddstr(win->win, displayLine, 1, cached->row);
+    whline(win->win, ' ', getmaxx(win->win) - getcurx(win->win) - 1);  // 남은 공간 공백 처리 (박스용 -1)
+
+    // 색깔 해제
+    removeColor(win->win, colorPair);
+}
+
+void formatFileRow(const DirEntry *entry, int winW, char *buf, size_t bufLen) {
+    const struct stat *fileStat = &entry->statEntry;  // 파일 스테이터스
     size_t fileSize = fileStat->st_size;  // 파일 사이즈
     char lastModDate[20];  // 날짜가 담기는 문자열
     char lastModTime[20];  // 시간이 담기는 문자열
-    int displayLine = line + 3;  // 출력되는 실제 라인 넘버
-    const char *format;  // 출력 포맷
+    const char *fileName = truncateFileName(entry->entryName);  // 파일 이름 너무 길면 자르기
 
     // 마지막 수정 시간
     struct tm tm;
@@ -313,74 +481,172 @@ void printFileInfo(DirWin *win, int startIdx, int line, int winW) {
     strftime(lastModDate, sizeof(lastModDate), "%y/%m/%d", &tm);
     strftime(lastModTime, sizeof(lastModTime), "%H:%M", &tm);
 
-    // 색상 선택
-    int colorPair = DEFAULT;
-    if ((S_ISDIR(fileStat->st_mode)) && isHidden(fileName)) {
-        colorPair = HIDDEN_FOLDER;
-    } else if (S_ISDIR(fileStat->st_mode)) {
-        colorPair = DIRECTORY;
-    } else if (isHidden(fileName)) {
-        colorPair = HIDDEN;
-    } else if (S_ISLNK(fileStat->st_mode)) {
-        colorPair = SYMBOLIC;
-    } else if (isImageFile(fileName)) {
-        colorPair = IMG;
-    } else if (isEXE(fileName)) {
-        colorPair = EXE;
+    if (winW >= 54) {  // 최대 너비
+        snprintf(buf, bufLen, "%-20s %10s %13s %s", fileName, formatSize(fileSize), lastModDate, lastModTime);
+    } else if (winW >= 41) {  // 중간 너비
+        snprintf(buf, bufLen, "%-20s %13s %s", fileName, lastModDate, lastModTime);
+    } else if (winW >= 35) {  // 최소 너비
+        snprintf(buf, bufLen, "%-20s %12s", fileName, formatSize(fileSize));
+    } else {
+        snprintf(buf, bufLen, "%-20s", fileName);
     }
-    // 파일 이름 너무 길면 자르기
-    fileName = truncateFileName(fileName);
+}
 
+void printDirWinLine(DirWin *win, int startIdx, int line, bool isSelected, int winW) {
+    if (isSelected)  // 선택된 것: 역상으로 출력
+        wattron(win->win, A_REVERSE);
+    if (win->groupView)
+        printGroupInfo(win, startIdx, line, winW);
+    else
+        printFileInfo(win, startIdx, line, winW);
+    if (isSelected)
+        wattroff(win->win, A_REVERSE);
+}
 
-    // 색깔 적용
-    applyColor(win->win, colorPair);
+// Group 보기 헤더 출력 함수
+void printGroupHeader(DirWin *win, int winW) {
+    applyColor(win->win, HEADER);
+    if (winW >= 41) {
+        mvwprintw(win->win, 1, 1, "%-20s|%-10s|%-12s|", "    EXTENSION", "  FILES", "  TOTAL SIZE");
+    } else if (winW >= 35) {
+        mvwprintw(win->win, 1, 1, "%-20s|%-10s|", "    EXTENSION", "  FILES");
+    } else {
+        mvwprintw(win->win, 1, 1, "%-20s|", "    EXTENSION");
+    }
+    whline(win->win, ' ', winW - getcurx(win->win) - 1);  // 남은 공간 공백 채우기
+    removeColor(win->win, HEADER);
+    mvwhline(win->win, 2, 1, 0, winW - 2);  // 구분선 출력
+}
 
-    // 출력 파트
-    if (winW >= 54) {  // 최대 너비
-        format = "%-20s %10s %13s %s";
-        mvwprintw(win->win, displayLine, 1, format, fileName, formatSize(fileSize), lastModDate, lastModTime);
-    } else if (winW >= 41) {  // 중간 너비
-        format = "%-20s %13s %s";
-        mvwprintw(win->win, displayLine, 1, format, fileName, lastModDate, lastModTime);
-    } else if (winW >= 35) {  // 최소 너비
-        format = "%-20s %12s";
-        mvwprintw(win->win, displayLine, 1, format, fileName, formatSize(fileSize));
+// Group 정보 출력 함수
+void printGroupInfo(DirWin *win, int startIdx, int line, int winW) {
+    ExtGroup *group = &win->extGroups[startIdx + line];
+    int displayLine = line + 3;  // 출력되는 실제 라인 넘버
+    const char *groupName;  // 출력할 Group 이름
+    int colorPair;
+
+    if (strcmp(group->ext, "/") == 0) {
+        groupName = "<DIR>";
+        colorPair = DIRECTORY;
+    } else if (group->ext[0] == '\0') {
+        groupName = "(none)";
+        colorPair = DEFAULT;
     } else {
-        format = "%-20s";
-        mvwprintw(win->win, displayLine, 1, format, fileName);
+        groupName = group->ext;
+        colorPair = DEFAULT;
     }
-    whline(win->win, ' ', getmaxx(win->win) - getcurx(win->win) - 1);  // 남은 공간 공백 처리 (박스용 -1)
 
-    // 색깔 해제
+    applyColor(win->win, colorPair);
+    if (winW >= 41) {
+        mvwprintw(win->win, displayLine, 1, "%-20s %10zu %12s", groupName, group->count, formatSize(group->totalBytes));
+    } else if (winW >= 35) {
+        mvwprintw(win->win, displayLine, 1, "%-20s %10zu", groupName, group->count);
+    } else {
+        mvwprintw(win->win, displayLine, 1, "%-20s", groupName);
+    }
+    whline(win->win, ' ', getmaxx(win->win) - getcurx(win->win) - 1);  // 남은 공간 공백 처리 (박스용 -1)
     removeColor(win->win, colorPair);
 }
 
-// 정렬 상태 토글 함수
-void toggleSort(int mask, int shift) {
-#define SORT_FLAG (windows[currentWin].sortFlag)
+void getSortMarker(uint16_t sortKeys, int criterion, char *buf) {
+    int keyCnt, found = -1, key;
+
+    // Key 수 세면서, 해당 기준의 순위 찾기
+    for (keyCnt = 0; keyCnt < DIRLISTENER_MAX_SORT_KEYS; keyCnt++) {
+        key = DIRLISTENER_SORTKEY_GET(sortKeys, keyCnt);
+        if ((key & DIRLISTENER_SORTKEY_CRITERION_MASK) == DIRLISTENER_SORTKEY_NONE)
+            break;
+        if ((key & DIRLISTENER_SORTKEY_CRITERION_MASK) == criterion)
+            found = keyCnt;
+    }
+
+    if (found == -1) {
+        buf[0] = '\0';
+        return;
+    }
+    key = DIRLISTENER_SORTKEY_GET(sortKeys, found);
+    if (keyCnt > 1)
+        sprintf(buf, "%c%d", (key & DIRLISTENER_SORTKEY_REVERSE) ? '^' : 'v', found + 1);
+    else
+        sprintf(buf, "%c", (key & DIRLISTENER_SORTKEY_REVERSE) ? '^' : 'v');
+}
+
+void printSortSummary(DirWin *win, int winW) {
+    static const char *criterionNames[] = { "", "Name", "Size", "Date", "Ext", "Type" };
+    char summary[64] = " Sort:";
+    bool needSummary = false;
+    int key;
+
+    for (int i = 0; i < DIRLISTENER_MAX_SORT_KEYS; i++) {
+        key = DIRLISTENER_SORTKEY_GET(win->sortKeys, i);
+        if ((key & DIRLISTENER_SORTKEY_CRITERION_MASK) == DIRLISTENER_SORTKEY_NONE)
+            break;
+        if (i > 0 || (key & DIRLISTENER_SORTKEY_CRITERION_MASK) > DIRLISTENER_SORTKEY_DATE)  // 열 Header만으로 알 수 없는 경우
+            needSummary = true;
+        sprintf(summary + strlen(summary), " %s%c", criterionNames[key & DIRLISTENER_SORTKEY_CRITERION_MASK], (key & DIRLISTENER_SORTKEY_REVERSE) ? '^' : 'v');
+    }
+    if (!needSummary || win->groupView)
+        return;
+    strcat(summary, " ");
+    mvwaddnstr(win->win, 0, 2, summary, winW - 4);
+}
+
+void printUnresponsiveMark(DirWin *win, int winH, int winW) {
+    static const char mark[] = " NOT RESPONDING ";
+
+    if (!win->isUnresponsive || winW < (int)sizeof(mark) + 3)
+        return;
+    wattron(win->win, A_REVERSE);
+    mvwaddstr(win->win, winH - 1, winW - (int)sizeof(mark) - 1, mark);
+    wattroff(win->win, A_REVERSE);
+}
 
-    // 현재 상태를 추출
-    int state = (SORT_FLAG & mask) >> shift;
+uint16_t toggleSortKey(int criterion, bool append) {
+    uint16_t sortKeys = windows[currentWin].sortKeys;
+    int i, key;
 
-    // 만약, 현재 상태가 00이면 이전의 다른 비트들을 모두 00으로 초기화
-    if (state == 0) {
-        // 다른 비트들은 모두 00으로 초기화
-        SORT_FLAG &= ~SORT_NAME_MASK;  // 이름 기준 비트 초기화
-        SORT_FLAG &= ~SORT_SIZE_MASK;  // 사이즈 기준 비트 초기화
-        SORT_FLAG &= ~SORT_DATE_MASK;  // 날짜 기준 비트 초기화
+    // 이미 있는 Key 위치 or 첫 빈 칸 찾기
+    for (i = 0; i < DIRLISTENER_MAX_SORT_KEYS; i++) {
+        key = DIRLISTENER_SORTKEY_GET(sortKeys, i) & DIRLISTENER_SORTKEY_CRITERION_MASK;
+        if (key == DIRLISTENER_SORTKEY_NONE || key == criterion)
+            break;
     }
+    bool found = i < DIRLISTENER_MAX_SORT_KEYS && (DIRLISTENER_SORTKEY_GET(sortKeys, i) & DIRLISTENER_SORTKEY_CRITERION_MASK) == criterion;
 
-    // 상태 순환: 01 -> 10 -> 01 순으로 순환
-    if (state == 0) {
-        state = 1;  // 첫 번째 -> 두 번째 (오름차순)
-    } else if (state == 1) {
-        state = 2;  // 두 번째 -> 세 번째 (내림차순)
+    if (!append) {
+        if (found && i == 0)
+            sortKeys ^= DIRLISTENER_SORTKEY_REVERSE;  // 이미 1순위: 방향 전환
+        else
+            sortKeys = criterion;  // 새 1순위 Key (오름차순), 나머지 Key 초기화
     } else {
-        state = 1;  // 세 번째 -> 첫 번째 (오름차순)
+        if (found) {
+            sortKeys ^= DIRLISTENER_SORTKEY_REVERSE << (i * DIRLISTENER_SORTKEY_BITS);  // 이미 있음: 방향 전환
+        } else {
+            if (i == DIRLISTENER_MAX_SORT_KEYS)  // 가득 참: 마지막 Key 대체
+                i = DIRLISTENER_MAX_SORT_KEYS - 1;
+            sortKeys &= ~(DIRLISTENER_SORTKEY_MASK << (i * DIRLISTENER_SORTKEY_BITS));
+            sortKeys |= criterion << (i * DIRLISTENER_SORTKEY_BITS);  // 오름차순으로 추가
+        }
     }
 
-    // 해당 비트에 상태 반영
-    SORT_FLAG = (SORT_FLAG & ~mask) | (state << shift);
+    windows[currentWin].sortKeys = sortKeys;
+    return sortKeys;
+}
+
+bool toggleGroupView(void) {
+    windows[currentWin].groupView = !windows[currentWin].groupView;
+    windows[currentWin].groupPos = 0;
+    return windows[currentWin].groupView;
+}
+
+bool isGroupView(void) {
+    return windows[currentWin].groupView;
+}
+
+void setDirWinUnresponsive(unsigned int winNo, bool isUnresponsive) {
+    if (winNo >= (unsigned int)winCnt)
+        return;
+    windows[winNo].isUnresponsive = isUnresponsive;
 }
 
 int calculateWinPos(int *y, int *x, int *h, int *w, unsigned int winNo, unsigned int winCnt) {
@@ -425,22 +691,58 @@ int calculateWinPos(int *y, int *x, int *h, int *w, unsigned int winNo, unsigned
 /*
 currentPos 변수 자체는 다른 thread에서 (추가로, 다른 file에서도) 접근 안 함 -> 별도 보호 없이 값 써도 안전
 단, totalReadItems 변수는 다른 thread와 공유되는 자원 -> mutex 획득 필요
-또한, moveCursorDown 함수는 현재 총 항목 수 필요
+또한, 아래로/끝으로/이름으로 이동하려면 현재 항목들 필요
 => mutex 획득 없이 처리 위해, 별도로 event 저장 -> 나중에 mutex 획득 후, 한 번에 계산
 */
 
 void moveCursorUp(void) {
-    // 이미 공간 다 썼다면 (= MSB가 1) -> 이후 수신된 이벤트 버림
-    if (windows[currentWin].lineMovementEvent & (UINT64_C(0x80) << (7 * 8)))
-        return;
-    windows[currentWin].lineMovementEvent = windows[currentWin].lineMovementEvent << 2 | 0x02;  // <한 칸 위로> Event 저장
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_UP, 0);
 }
 
 void moveCursorDown(void) {
-    // 이미 공간 다 썼다면 (= MSB가 1) -> 이후 수신된 이벤트 버림
-    if (windows[currentWin].lineMovementEvent & (UINT64_C(0x80) << (7 * 8)))
-        return;
-    windows[currentWin].lineMovementEvent = windows[currentWin].lineMovementEvent << 2 | 0x03;  // <한 칸 아래로> Event 저장
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_DOWN, 0);
+}
+
+void moveCursorPageUp(void) {
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_PAGE_UP, 0);
+}
+
+void moveCursorPageDown(void) {
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_PAGE_DOWN, 0);
+}
+
+void moveCursorHome(void) {
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_HOME, 0);
+}
+
+void moveCursorEnd(void) {
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_END, 0);
+}
+
+void jumpToNamePrefix(const char *prefix) {
+    pushCursorJumpPrefix(&windows[currentWin].cursorEvents, prefix);
+}
+
+void applyCursorEvents(DirWin *win) {
+    size_t itemsCnt;
+    size_t *pos;
+    if (win->groupView) {
+        itemsCnt = *win->totalExtGroups;
+        pos = &win->groupPos;
+    } else {
+        itemsCnt = *win->totalReadItems;
+        pos = &win->currentPos;
+    }
+
+    CursorMove move = drainCursorEvents(&win->cursorEvents);
+    size_t prefixPos = *pos;
+    if (move.hasAnchor && move.anchor == CURSOR_JUMP_PREFIX && !win->groupView) {
+        ssize_t found = findByNamePrefix(win->dirEntry, win->nameIndex, itemsCnt, move.prefix);
+        if (found != -1)
+            prefixPos = found;
+    }
+    int pageSize = getmaxy(win->win) - 4;  // 항목 출력 줄 수
+    *pos = applyCursorMove(&move, *pos, itemsCnt, pageSize > 1 ? pageSize : 1, prefixPos);
 }
 
 void selectPreviousWindow(void) {
@@ -480,8 +782,9 @@ int setDirWinCnt(int count) {
 
 SrcDstInfo getCurrentSelectedItem(void) {
     DirWin *currentWinArgs = windows + currentWin;
-    size_t currentSelection = currentWinArgs->currentPos;
     assert(pthread_mutex_lock(currentWinArgs->bufMutex) == 0);
+    applyCursorEvents(currentWinArgs);  // 아직 화면에 반영 안 된 이동 (같은 Frame에 입력된 키) 먼저 적용
+    size_t currentSelection = currentWinArgs->currentPos;
     struct stat *statEntry = &currentWinArgs->dirEntry[currentSelection].statEntry;
     SrcDstInfo result = {
         .dirFd = -1,  // Directory is unknown -> Prevent bug
@@ -495,7 +798,7 @@ SrcDstInfo getCurrentSelectedItem(void) {
 }
 
 void setCurrentSelection(size_t index) {
-    windows[currentWin].currentPos = index;
+    pushCursorEvent(&windows[currentWin].cursorEvents, CURSOR_JUMP_INDEX, index);  // 새 목록 읽어들인 뒤 적용
 }
 
 unsigned int getCurrentWindow(void) {
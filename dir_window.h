@@ -2,45 +2,44 @@
 #define _DIR_WINDOW_H_INCLUDED_
 
 #include <pthread.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "dir_listener.h"
 #include "file_operator.h"
 
 
-// 이름 정렬 상태를 나타내는 비트마스크
-#define SORT_NAME_MASK 0x03  // 00000011
-// 크기 정렬 상태를 나타내는 비트마스크
-#define SORT_SIZE_MASK 0x0C  // 00001100
-// 날짜 정렬 상태를 나타내는 비트마스크
-#define SORT_DATE_MASK 0x30  // 00110000
-
-// 이름 정렬 상태를 위한 비트 쉬프트
-#define SORT_NAME_SHIFT 0
-// 크기 정렬 상태를 위한 비트 쉬프트
-#define SORT_SIZE_SHIFT 2
-// 날짜 정렬 상태를 위한 비트 쉬프트
-#define SORT_DATE_SHIFT 4
-
 /**
  * 새 폴더 표시 창 초기화 (생성)
  *
  * @param bufMutex Stat 및 이름 Mutex
- * @param bufEntryStat 항목들의 stat 정보
- * @param bufEntryNames 항목들의 이름
  * @param totalReadItems 현 폴더에서 읽어들인 항목 수
+ * @param dirEntry 항목들의 이름 및 stat 정보
+ * @param totalExtGroups 확장자 Group 수
+ * @param extGroups 확장자별 통계
+ * @param generation 항목/통계 변경 횟수 (바뀐 경우만 창 전체 다시 그림)
+ * @param nameIndex 이름순 항목 Index (이름 앞부분으로 이동할 때 사용)
  * @return 성공: (창 초기화 후 창 개수), 실패: -1
  */
 int initDirWin(
     pthread_mutex_t *bufMutex,
     size_t *totalReadItems,
-    DirEntry *dirEntry
+    DirEntry *dirEntry,
+    size_t *totalExtGroups,
+    ExtGroup *extGroups,
+    uint64_t *generation,
+    uint16_t *nameIndex
 );
 
 /**
  * 폴더 표시 창들 업데이트
  *
  * @return 성공: 0, 실패: -1
+ *
+ * @details
+ * - 창마다 마지막으로 그린 상태 기억: 바뀐 것 없으면 창 건너뜀
+ * - 커서만 움직인 경우: 이전/현재 커서 줄만 다시 그림
  */
 int updateDirWins(void);
 
@@ -54,6 +53,36 @@ void moveCursorUp(void);
  */
 void moveCursorDown(void);
 
+/**
+ * 선택된 창의 커서 한 화면 위로 이동
+ */
+void moveCursorPageUp(void);
+
+/**
+ * 선택된 창의 커서 한 화면 아래로 이동
+ */
+void moveCursorPageDown(void);
+
+/**
+ * 선택된 창의 커서 맨 위로 이동
+ */
+void moveCursorHome(void);
+
+/**
+ * 선택된 창의 커서 맨 아래로 이동
+ */
+void moveCursorEnd(void);
+
+/**
+ * 선택된 창의 커서를 이름이 prefix로 시작하는 (이름순으로) 첫 항목으로 이동
+ *
+ * @param prefix 찾을 이름 앞부분 (대소문자 구분 X)
+ *
+ * @details
+ * - 못 찾음, Group 보기: 이동 X
+ */
+void jumpToNamePrefix(const char *prefix);
+
 /**
  * 왼쪽 창 선택
  */
@@ -80,7 +109,9 @@ int setDirWinCnt(int count);
 SrcDstInfo getCurrentSelectedItem(void);
 
 /**
- * 현재 창의 선택된 폴더 Index 변경
+ * 현재 창의 선택된 폴더 Index 변경 (다음 갱신 때 적용)
+ *
+ * @param index 새 선택 Index (범위 벗어나면: 마지막 항목)
  */
 void setCurrentSelection(size_t index);
 
@@ -92,11 +123,38 @@ void setCurrentSelection(size_t index);
 unsigned int getCurrentWindow(void);
 
 /**
- * 정렬 상태를 토글
+ * 현재 창의 정렬 Key 변경
+ *
+ * @param criterion 정렬 기준 (DIRLISTENER_SORTKEY_NAME 등)
+ * @param append false: 1순위 Key로 설정 (이미 1순위면: 방향 전환)
+ *               true: 마지막 Key로 추가 (이미 있으면: 해당 Key 방향 전환, 가득 찼으면: 마지막 Key 대체)
+ * @return 변경된 정렬 Key 조합 (Listener에 전달해야 함)
+ */
+uint16_t toggleSortKey(int criterion, bool append);
+
+/**
+ * 현재 창의 '확장자별 Group 보기' 전환
+ *
+ * @return 전환 후 Group 보기 여부
+ */
+bool toggleGroupView(void);
+
+/**
+ * 현재 창이 '확장자별 Group 보기' 상태인지 확인
+ *
+ * @return Group 보기: true, 일반 목록: false
+ */
+bool isGroupView(void);
+
+/**
+ * 창의 '응답 없음' 표시 여부 설정 (바뀐 경우에만 다시 그림)
+ *
+ * @param winNo 창 번호
+ * @param isUnresponsive Listener가 파일 시스템 호출에서 멈춰 있는지
  *
- * @param mask 적용할 비트마스크 (SORT_NAME_MASK, SORT_SIZE_MASK, SORT_DATE_MASK 중 하나)
- * @param shift 비트 쉬프트 값 (SORT_NAME_SHIFT, SORT_SIZE_SHIFT, SORT_DATE_SHIFT 중 하나)
+ * @details
+ * - 멈춘 동안에도 마지막으로 읽은 목록은 그대로 표시, 탐색 가능
  */
-void toggleSort(int mask, int shift);
+void setDirWinUnresponsive(unsigned int winNo, bool isUnresponsive);
 
 #endif
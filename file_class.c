@@ -0,0 +1,245 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include "colors.h"
+#include "config.h"
+#include "dir_entry_utils.h"
+#include "file_class.h"
+
+#define EXT_TABLE_SIZE 2048  // 확장자 Hash Table 크기 (2의 거듭제곱, MAX_CLASSIFIED_EXTS의 2배 이상: 빈 칸 유지)
+_Static_assert((EXT_TABLE_SIZE & (EXT_TABLE_SIZE - 1)) == 0, "EXT_TABLE_SIZE must be a power of 2");
+_Static_assert(EXT_TABLE_SIZE >= MAX_CLASSIFIED_EXTS * 2, "EXT_TABLE_SIZE too small");
+
+
+/**
+ * @struct _ExtClass
+ *
+ * @var _ExtClass::ext 확장자 ('.' 제외, 소문자) / 빈 문자열: 빈 칸
+ * @var _ExtClass::colorPair 색상 Pair 번호
+ */
+typedef struct _ExtClass {
+    char ext[MAX_EXT_LEN + 1];  // 확장자 ('.' 제외, 소문자)
+    uint8_t colorPair;  // 색상 Pair 번호
+} ExtClass;
+
+static ExtClass extTable[EXT_TABLE_SIZE];  // Open Addressing (Linear Probing)
+static size_t totalExts;
+
+
+/**
+ * 확장자 Hash (FNV-1a, 대소문자 구분 X)
+ *
+ * @param ext 확장자 ('.' 제외)
+ * @param len 확장자 길이
+ * @return Hash 값
+ */
+static inline uint32_t hashExt(const char *ext, size_t len);
+
+/**
+ * 확장자 -> 색상 Pair 등록 (이미 있으면 덮어씀)
+ *
+ * @param ext 확장자 ('.' 제외, 대소문자 무관)
+ * @param len 확장자 길이
+ * @param colorPair 색상 Pair 번호
+ */
+static void addExtClass(const char *ext, size_t len, uint8_t colorPair);
+
+/**
+ * 확장자의 색상 Pair 검색
+ *
+ * @param ext 확장자 ('.' 제외, 대소문자 무관)
+ * @param len 확장자 길이
+ * @return 찾음: 색상 Pair 번호, 없음: DEFAULT
+ */
+static uint8_t findExtClass(const char *ext, size_t len);
+
+/**
+ * LS_COLORS의 SGR 색 코드 (예: "01;32", "38;5;208")에서 글자 색 추출
+ *
+ * @param sgr SGR 코드 문자열 (끝: ':' or '\0')
+ * @return 글자 색 (ncurses 색 번호), 글자 색 없음: -1
+ */
+static short parseSgrForeground(const char *sgr);
+
+/**
+ * 앱이 재정의한 색 번호 (`COLOR_ORANGE` ~ `COLOR_LAST` 전)와 겹치는 256색 번호를 가장 가까운 기본 색으로 변환
+ *
+ * @param color 256색 번호 (16 ~ `COLOR_LAST` - 1)
+ * @return 기본 색 번호 (0~7, 16색 이상 지원 + 밝은 색: 8~15)
+ *
+ * @details
+ * - 256색 16~231번: 6x6x6 RGB Cube (단계: 0, 95, 135, 175, 215, 255)
+ * - 가장 밝은 성분의 절반 이상인 성분만 켬 (모두 0: 검정)
+ */
+static short remapRedefinedColor(short color);
+
+/**
+ * LS_COLORS 환경 변수 읽어 확장자 등록
+ */
+static void loadLsColors(void);
+
+
+void initFileClasses(void) {
+    static const char *imageExts[] = { "jpg", "jpeg", "png", "gif", "bmp" };
+    static const char *exeExts[] = { "exe", "out" };
+
+    for (size_t i = 0; i < sizeof(imageExts) / sizeof(imageExts[0]); i++)
+        addExtClass(imageExts[i], strlen(imageExts[i]), IMG);
+    for (size_t i = 0; i < sizeof(exeExts) / sizeof(exeExts[0]); i++)
+        addExtClass(exeExts[i], strlen(exeExts[i]), EXE);
+
+    loadLsColors();
+}
+
+uint8_t classifyEntry(const DirEntry *entry) {
+    mode_t mode = entry->statEntry.st_mode;
+    bool hidden = isHidden(entry->entryName);
+
+    if (S_ISDIR(mode))
+        return hidden ? HIDDEN_FOLDER : DIRECTORY;
+    if (hidden)
+        return HIDDEN;
+    if (S_ISLNK(mode))
+        return SYMBOLIC;
+    if (entry->extOffset >= entry->nameLen)  // 확장자 없음
+        return DEFAULT;
+    return findExtClass(entry->entryName + entry->extOffset + 1, entry->nameLen - entry->extOffset - 1);
+}
+
+uint32_t hashExt(const char *ext, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)tolower((unsigned char)ext[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void addExtClass(const char *ext, size_t len, uint8_t colorPair) {
+    if (len == 0 || len > MAX_EXT_LEN)
+        return;
+
+    uint32_t slot = hashExt(ext, len) & (EXT_TABLE_SIZE - 1);
+    while (extTable[slot].ext[0] != '\0') {
+        if (strlen(extTable[slot].ext) == len && strncasecmp(extTable[slot].ext, ext, len) == 0) {  // 이미 있음: 덮어씀
+            extTable[slot].colorPair = colorPair;
+            return;
+        }
+        slot = (slot + 1) & (EXT_TABLE_SIZE - 1);
+    }
+    if (totalExts >= MAX_CLASSIFIED_EXTS)
+        return;
+
+    for (size_t i = 0; i < len; i++)
+        extTable[slot].ext[i] = tolower((unsigned char)ext[i]);
+    extTable[slot].ext[len] = '\0';
+    extTable[slot].colorPair = colorPair;
+    totalExts++;
+}
+
+uint8_t findExtClass(const char *ext, size_t len) {
+    if (len > MAX_EXT_LEN)  // 등록될 수 없는 길이
+        return DEFAULT;
+
+    uint32_t slot = hashExt(ext, len) & (EXT_TABLE_SIZE - 1);
+    while (extTable[slot].ext[0] != '\0') {
+        if (strncasecmp(extTable[slot].ext, ext, len) == 0 && extTable[slot].ext[len] == '\0')
+            return extTable[slot].colorPair;
+        slot = (slot + 1) & (EXT_TABLE_SIZE - 1);
+    }
+    return DEFAULT;
+}
+
+short parseSgrForeground(const char *sgr) {
+    short fg = -1;
+    char *end;
+    long code;
+
+    while (*sgr != '\0' && *sgr != ':') {
+        code = strtol(sgr, &end, 10);
+        if (end == sgr)  // 숫자 아님: 잘못된 형식
+            return -1;
+        sgr = end;
+
+        if (code >= 30 && code <= 37) {
+            fg = code - 30;
+        } else if (code >= 90 && code <= 97) {  // 밝은 색: 16색 이상 지원하면 8~15번 사용
+            fg = COLORS >= 16 ? code - 90 + 8 : code - 90;
+        } else if (code == 39) {
+            fg = -1;
+        } else if (code == 38) {  // 확장 색: "38;5;N" or "38;2;R;G;B"
+            int argCnt = 0;
+            long args[4];
+            while (*sgr == ';' && argCnt < 4) {
+                args[argCnt++] = strtol(sgr + 1, &end, 10);
+                sgr = end;
+                if (argCnt == 2 && args[0] == 5)
+                    break;
+            }
+            if (argCnt == 2 && args[0] == 5 && args[1] >= 0 && args[1] < 256) {
+                fg = args[1];  // 256색 (RGB 색은 무시)
+                if (fg >= COLOR_ORANGE && fg < COLOR_LAST)  // 앱이 재정의한 색 (배경 주황색 등): 원래 색으로 표시 불가
+                    fg = remapRedefinedColor(fg);
+            }
+        }
+
+        if (*sgr == ';')
+            sgr++;
+    }
+    return fg;
+}
+
+short remapRedefinedColor(short color) {
+    static const short levels[6] = { 0, 95, 135, 175, 215, 255 };
+    int cube = color - 16;
+    short rgb[3] = { levels[cube / 36], levels[cube / 6 % 6], levels[cube % 6] };
+    short maxLevel = rgb[0] > rgb[1] ? rgb[0] : rgb[1];
+    if (rgb[2] > maxLevel)
+        maxLevel = rgb[2];
+    if (maxLevel == 0)
+        return COLOR_BLACK;
+
+    short basic = 0;
+    for (int i = 0; i < 3; i++) {  // 기본 색 번호: bit 0 빨강, bit 1 초록, bit 2 파랑
+        if (rgb[i] * 2 >= maxLevel)
+            basic |= 1 << i;
+    }
+    if (maxLevel >= 215 && COLORS >= 16)  // 밝은 색
+        basic += 8;
+    return basic;
+}
+
+void loadLsColors(void) {
+    const char *lsColors = getenv("LS_COLORS");
+    if (lsColors == NULL)
+        return;
+
+    // 형식: "di=01;34:ln=01;36:*.jpg=01;35:..." -> "*.확장자=색" 항목만 사용
+    const char *item = lsColors;
+    while (*item != '\0') {
+        const char *itemEnd = strchr(item, ':');
+        if (itemEnd == NULL)
+            itemEnd = item + strlen(item);
+
+        const char *equals = memchr(item, '=', itemEnd - item);
+        if (equals != NULL && item[0] == '*' && item[1] == '.') {
+            const char *ext = item + 2;
+            size_t extLen = equals - ext;
+            short fg = parseSgrForeground(equals + 1);
+
+            if (memchr(ext, '.', extLen) == NULL) {  // 여러 단계 확장자 (예: "*.tar.gz")는 마지막 확장자만 비교하므로 제외
+                if (fg >= 0)
+                    addExtClass(ext, extLen, addColorPair(fg));
+                else
+                    addExtClass(ext, extLen, DEFAULT);  // 색 없음: 기본 목록 덮어씀
+            }
+        }
+
+        item = *itemEnd == ':' ? itemEnd + 1 : itemEnd;
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef _FILE_CLASS_H_INCLUDED_
+#define _FILE_CLASS_H_INCLUDED_
+
+#include <stdint.h>
+
+#include "dir_listener.h"
+
+
+/**
+ * 확장자 -> 색상 Pair 표 생성 (기본 확장자 목록 + LS_COLORS 환경 변수)
+ *
+ * @details
+ * - 반드시 initColors() 이후, Directory Listener Thread 시작 전 호출 (이후: 읽기 전용)
+ * - 기본: 이미지 (`.jpg`, `.jpeg`, `.png`, `.gif`, `.bmp`) -> IMG, 실행 파일 (`.exe`, `.out`) -> EXE
+ * - LS_COLORS의 `*.확장자=색` 항목: 글자 색만 사용, 기본 목록보다 우선
+ * - 확장자는 대소문자 구분 없음 (소문자로 저장)
+ */
+void initFileClasses(void);
+
+/**
+ * 항목의 표시 색상 결정 (목록 읽어들일 때 1회 호출)
+ *
+ * @param entry 이름, stat, extOffset이 채워진 디렉토리 항목
+ * @return 색상 Pair 번호 (PAIR_COLOR or addColorPair()로 추가된 Pair)
+ *
+ * @details
+ * - 우선 순위: 숨김 폴더 > 폴더 > 숨김 파일 > 심볼릭 링크 > 확장자
+ */
+uint8_t classifyEntry(const DirEntry *entry);
+
+#endif
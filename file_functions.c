@@ -5,30 +5,47 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/sysmacros.h>
 #include <sys/types.h>
 
 #include "config.h"
 #include "file_functions.h"
 #include "file_operator.h"
+#include "job_queue.h"
+#include "thread_commons.h"
+#include "trace.h"
+#include "uring_copy.h"
 
 #define COPY_CHUNK_SIZE (1024 * 1024)  // 1MB 단위로 복사
 
 #define FILEOP_SET_OPERATION(progress, fileName, operationFlag) \
     do { \
-        pthread_mutex_lock(&(progress)->flagMutex); \
+        lockMutex(&(progress)->flagMutex); \
         (progress)->flags |= (operationFlag); \
         (progress)->flags &= ~PROGRESS_PERCENT_MASK; \
         strcpy((progress)->name, (fileName)); \
         pthread_mutex_unlock(&(progress)->flagMutex); \
+        notifyUi(UI_WAKE_DATA); \
     } while (0)
 #define FILEOP_SET_RESULT(progress, operationFlag, isFailed) \
     do { \
-        pthread_mutex_lock(&(progress)->flagMutex); \
+        lockMutex(&(progress)->flagMutex); \
         (progress)->flags = ((isFailed) ? ((operationFlag) | PROGRESS_PREV_FAIL) : (operationFlag)); \
         pthread_mutex_unlock(&(progress)->flagMutex); \
+        notifyUi(UI_WAKE_DATA); \
+    } while (0)
+#define FILEOP_CLEAR_OPERATION(progress, operationFlag) \
+    do { \
+        lockMutex(&(progress)->flagMutex); \
+        (progress)->flags &= ~(operationFlag); \
+        pthread_mutex_unlock(&(progress)->flagMutex); \
+        notifyUi(UI_WAKE_DATA); \
     } while (0)
 
 
@@ -36,88 +53,1274 @@ extern int directoryOpenArgs;
 
 
 /**
- * COPY_CHUNK_SIZE 단위로 분할 복사, 진행률 갱신
+ * @struct _CopyDir
+ * 복사 중인 폴더 1개 (하위 항목들이 공유)
  *
- * @param srcFd 원본 파일 descriptor
- * @param dstFd 대상 파일 descriptor
+ * @var _CopyDir::srcDir 원본 폴더 (하위 항목 열 때: dirfd() 사용)
+ * @var _CopyDir::dstFd 대상 폴더
+ * @var _CopyDir::refs 아직 끝나지 않은 하위 항목 수 (0: 닫음, Atomic 접근)
+ */
+typedef struct _CopyDir {
+    DIR *srcDir;  // 원본 폴더
+    int dstFd;  // 대상 폴더
+    unsigned int refs;  // 아직 끝나지 않은 하위 항목 수
+} CopyDir;
+
+/**
+ * @struct _CopyItem
+ * 복사할 항목 1개 (파일 or 폴더): 참여한 Thread 중 아무나 가져가 처리
+ *
+ * @var _CopyItem::next 다음 대기 항목
+ * @var _CopyItem::parent 항목이 있는 폴더 (원본, 대상 이름 같음)
+ * @var _CopyItem::mode 파일 종류, 권한
+ * @var _CopyItem::fileSize 파일 크기
+ * @var _CopyItem::isSparse Hole 있음 (할당된 크기 < 파일 크기)
+ * @var _CopyItem::name 이름
+ */
+typedef struct _CopyItem {
+    struct _CopyItem *next;  // 다음 대기 항목
+    CopyDir *parent;  // 항목이 있는 폴더
+    mode_t mode;  // 파일 종류, 권한
+    size_t fileSize;  // 파일 크기
+    bool isSparse;  // Hole 있음
+    char name[];  // 이름
+} CopyItem;
+
+/**
+ * @struct _CopyJob
+ * 폴더 복사 1개: 하위 항목들을 File Operator Thread들이 나눠 처리
+ *
+ * @var _CopyJob::mutex 아래 변수들 보호 (isFailed 제외)
+ * @var _CopyJob::changed 대기 항목 추가됨, 작업 끝남 or 참여 Thread 떠남
+ * @var _CopyJob::items 대기 항목들 (Stack: 최근 펼친 폴더의 항목부터 -> 동시에 열린 폴더 수 최소화)
+ * @var _CopyJob::pending 대기 + 처리 중인 항목 수 (0: 작업 끝)
+ * @var _CopyJob::workers 참여 중인 Thread 수 (작업 받은 Thread 포함)
+ * @var _CopyJob::helpWanted 도움 요청했지만 아직 참여하지 않은 Thread 수
+ * @var _CopyJob::isFailed 항목 1개 이상 실패 (Atomic 접근)
+ * @var _CopyJob::isReflinkUnsupported Extent 공유 안 됨 확인 (이후 작은 파일: io_uring으로 묶어 복사 가능, Atomic 접근)
+ * @var _CopyJob::progress 작업 받은 Thread의 진행 상태 (참여 Thread 모두 여기에 합산)
+ * @var _CopyJob::fileJob 취소, 일시정지 확인할 파일 작업 (크기 합도 여기에 기록, NULL: 기록 X)
+ * @var _CopyJob::next 진행 중인 다음 작업 (copyJobsMutex로 보호)
+ */
+typedef struct _CopyJob {
+    pthread_mutex_t mutex;  // 아래 변수들 보호
+    pthread_cond_t changed;  // 대기 항목 추가, 작업 끝, 참여 Thread 떠남
+    CopyItem *items;  // 대기 항목들
+    unsigned int pending;  // 대기 + 처리 중인 항목 수
+    unsigned int workers;  // 참여 중인 Thread 수
+    unsigned int helpWanted;  // 도움 요청했지만 아직 참여하지 않은 Thread 수
+    bool isFailed;  // 항목 1개 이상 실패
+    bool isReflinkUnsupported;  // Extent 공유 안 됨 확인
+    FileProgressInfo *progress;  // 작업 받은 Thread의 진행 상태
+    FileJob *fileJob;  // 취소, 일시정지 확인할 파일 작업
+    struct _CopyJob *next;  // 진행 중인 다음 작업
+} CopyJob;
+
+/**
+ * @enum _CopyStepResult
+ * 복사 방식 1개의 결과
+ */
+typedef enum _CopyStepResult {
+    COPY_STEP_DONE,  // 복사 끝남
+    COPY_STEP_FAILED,  // 실패 or 취소됨
+    COPY_STEP_UNSUPPORTED  // 이 방식 사용 불가: 다음 방식이 복사한 곳 (pos)부터 이어서 복사
+} CopyStepResult;
+
+/**
+ * @struct _CopyState
+ * 파일 1개 복사 상태 (복사 방식들이 차례로 이어받음)
+ *
+ * @var _CopyState::srcFd 원본 파일 descriptor
+ * @var _CopyState::dstFd 대상 파일 descriptor
+ * @var _CopyState::fileSize 원본 파일 크기
+ * @var _CopyState::dataBytes 원본의 데이터 구간 크기 합 (Hole 제외: 진행률 기준)
+ * @var _CopyState::pos 복사 중인 데이터 구간에서 다음에 복사할 위치 (다음 방식의 시작 위치)
+ * @var _CopyState::end 복사 중인 데이터 구간의 끝
+ * @var _CopyState::copied 지금까지 복사한 크기 합
+ * @var _CopyState::progress 진행 상태 구조체
+ * @var _CopyState::fileJob 취소, 일시정지 확인할 파일 작업 (NULL: 확인 X)
+ * @var _CopyState::job 참여 중인 폴더 복사 (NULL: 파일 1개 복사)
+ * @var _CopyState::reflink Extent 공유 여부
+ * @var _CopyState::cache Page Cache 사용 방식 (CACHE_DIRECT인데 O_DIRECT 지원 X: CACHE_STREAM으로 바뀜)
+ * @var _CopyState::directAlign O_DIRECT로 읽고 쓰는 중: 위치, 크기 정렬 단위 (0: O_DIRECT 아님)
+ * @var _CopyState::flushedPos Streaming 복사: 여기까지 Writeback 시작함
+ * @var _CopyState::droppedPos Streaming 복사: 여기까지 Page Cache에서 제거함
+ * @var _CopyState::pipeFds splice() 복사용 Pipe (-1: 아직 없음, 복사 끝나면 close())
+ */
+typedef struct _CopyState {
+    int srcFd;  // 원본 파일 descriptor
+    int dstFd;  // 대상 파일 descriptor
+    size_t fileSize;  // 원본 파일 크기
+    size_t dataBytes;  // 원본의 데이터 구간 크기 합
+    off_t pos;  // 복사 중인 데이터 구간에서 다음에 복사할 위치
+    off_t end;  // 복사 중인 데이터 구간의 끝
+    size_t copied;  // 지금까지 복사한 크기 합
+    FileProgressInfo *progress;  // 진행 상태 구조체
+    FileJob *fileJob;  // 취소, 일시정지 확인할 파일 작업
+    CopyJob *job;  // 참여 중인 폴더 복사
+    ReflinkMode reflink;  // Extent 공유 여부
+    CacheMode cache;  // Page Cache 사용 방식
+    size_t directAlign;  // O_DIRECT 정렬 단위
+    off_t flushedPos;  // 여기까지 Writeback 시작함
+    off_t droppedPos;  // 여기까지 Page Cache에서 제거함
+    int pipeFds[2];  // splice() 복사용 Pipe
+} CopyState;
+
+/**
+ * @struct _CopyBuffer
+ * read() -> write() 복사용 Buffer 1개 (Page 단위 정렬)
+ *
+ * @var _CopyBuffer::data Buffer 시작 (NULL: 빈 자리)
+ * @var _CopyBuffer::size Buffer 크기
+ */
+typedef struct _CopyBuffer {
+    char *data;  // Buffer 시작
+    size_t size;  // Buffer 크기
+} CopyBuffer;
+
+/**
+ * @struct _BufferedCopy
+ * read() -> write() 복사 중 읽기 Thread와 쓰기 Thread (복사 Thread)가 공유하는 상태 (Buffer 2개 번갈아 사용)
+ *
+ * @var _BufferedCopy::mutex 아래 변수들 보호 (srcFd, readPos, end, bufs 제외: 읽기 Thread만 사용 or 변경 X)
+ * @var _BufferedCopy::changed Buffer 채워짐, 비워짐 or 중단 요청
+ * @var _BufferedCopy::srcFd 원본 파일 descriptor
+ * @var _BufferedCopy::readPos 다음에 읽을 위치
+ * @var _BufferedCopy::end 복사할 데이터 구간의 끝
+ * @var _BufferedCopy::bufs Buffer 2개 (Chunk 크기)
+ * @var _BufferedCopy::align 읽는 크기 올림 단위 (O_DIRECT: 정렬 단위, 아니면 1)
+ * @var _BufferedCopy::isFilled Buffer별 읽은 내용 있음 (쓰기 Thread가 쓴 후 비움)
+ * @var _BufferedCopy::lens Buffer별 읽은 크기 (0: EOF, -1: 실패)
+ * @var _BufferedCopy::errors Buffer별 읽기 실패 시 errno
+ * @var _BufferedCopy::isStopped 중단 요청 (쓰기 실패, 취소 or 복사 끝)
+ */
+typedef struct _BufferedCopy {
+    pthread_mutex_t mutex;  // 아래 변수들 보호
+    pthread_cond_t changed;  // Buffer 채워짐, 비워짐 or 중단 요청
+    int srcFd;  // 원본 파일 descriptor
+    off_t readPos;  // 다음에 읽을 위치
+    off_t end;  // 복사할 데이터 구간의 끝
+    CopyBuffer bufs[2];  // Buffer 2개
+    size_t align;  // 읽는 크기 올림 단위
+    bool isFilled[2];  // Buffer별 읽은 내용 있음
+    ssize_t lens[2];  // Buffer별 읽은 크기
+    int errors[2];  // Buffer별 읽기 실패 시 errno
+    bool isStopped;  // 중단 요청
+} BufferedCopy;
+
+
+static CopyJob *copyJobs;  // 진행 중인 폴더 복사 작업들 (도움 요청 받은 Thread가 찾아 참여)
+static pthread_mutex_t copyJobsMutex = PTHREAD_MUTEX_INITIALIZER;  // copyJobs 보호 (순서: copyJobsMutex -> CopyJob::mutex)
+
+static CopyBuffer copyBufPool[COPY_BUF_POOL_SIZE];  // 다 쓴 read() -> write() 복사용 Buffer들 (다음 복사에서 재사용)
+static dev_t lastBufDev;  // 마지막으로 확인한 원본 장치 (회전 디스크 여부 Cache)
+static bool isLastBufDevRotational;  // lastBufDev가 회전 디스크인지 여부
+static pthread_mutex_t copyBufMutex = PTHREAD_MUTEX_INITIALIZER;  // 위 변수들 보호
+
+
+// 아래에서, CopyDir에 대해 leak 경고 발생
+// 하위 항목 수로 참조 횟수 관리 (마지막 항목 끝날 때 해제) -> analyzer가 추적하지 못함
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wanalyzer-malloc-leak"
+/**
+ * 복사 진행률 갱신 (백분율 바뀐 경우만 화면 갱신 알림)
+ *
+ * @param progress 진행 상태 구조체
+ * @param totalCopied 지금까지 복사한 크기
  * @param fileSize 원본 파일 크기
+ */
+static void updateCopyProgress(FileProgressInfo *progress, size_t totalCopied, size_t fileSize) {
+    int percent = fileSize == 0 ? 100 : (int)((double)totalCopied / fileSize * 100);
+    bool isChanged;
+
+    lockMutex(&progress->flagMutex);
+    isChanged = ((progress->flags & PROGRESS_PERCENT_MASK) >> PROGRESS_PERCENT_START) != percent;
+    progress->flags &= ~PROGRESS_PERCENT_MASK;
+    progress->flags |= percent << PROGRESS_PERCENT_START;
+    pthread_mutex_unlock(&progress->flagMutex);
+    if (isChanged)
+        notifyUi(UI_WAKE_PROGRESS);
+}
+
+/**
+ * 복사한 만큼 작업의 크기 합, 진행률 갱신 (폴더 복사 중: 작업 전체 기준)
+ *
  * @param progress 진행 상태 구조체
- * @param flagMutex 진행률 보호 Mutex
- * @return 성공: 0, 실패: -1
+ * @param fileJob 복사한 크기 합 기록할 파일 작업 (NULL: 기록 X)
+ * @param job 참여 중인 폴더 복사 (NULL: 파일 1개 복사)
+ * @param chunk 이번에 복사한 크기
+ * @param totalCopied 이 파일에서 지금까지 복사한 크기
+ * @param fileSize 원본 파일 크기
  */
-static int doCopyFile(int srcFd, int dstFd, size_t fileSize, FileProgressInfo *progress) {
-    size_t totalCopied = 0;
-#if defined(_GNU_SOURCE) && (__LP64__ || (defined(_FILE_OFFSET_BITS) && _FILE_OFFSET_BITS == 64))
-    // copy_file_range 사용 가능하면 사용 (kernel에서 바로 복사 -> 성능상 유리)
-    off_t offIn = 0, offOut = 0;
-    ssize_t copied = 0;
+static void reportCopied(FileProgressInfo *progress, FileJob *fileJob, CopyJob *job, size_t chunk, size_t totalCopied, size_t fileSize) {
+    if (fileJob == NULL) {  // 작업 전체 크기 모름: 파일 기준
+        updateCopyProgress(progress, totalCopied, fileSize);
+        return;
+    }
+    uint64_t copied = __atomic_add_fetch(&fileJob->doneBytes, chunk, __ATOMIC_RELAXED);
+    if (job == NULL) {
+        updateCopyProgress(progress, totalCopied, fileSize);
+        return;
+    }
+    // 전체 크기: 아직 펼치지 않은 폴더 제외 -> 지금까지 찾은 크기 기준
+    uint64_t total = __atomic_load_n(&fileJob->totalBytes, __ATOMIC_RELAXED);
+    updateCopyProgress(job->progress, copied, total > copied ? total : copied);
+}
+
+/**
+ * Streaming 복사 준비 (데이터 구간 복사 전)
+ *
+ * @param state 복사 상태 (CACHE_DIRECT인데 O_DIRECT 지원 X: cache가 CACHE_STREAM으로 바뀜)
+ *
+ * @details
+ * - 원본: atime 갱신 X (O_NOATIME, 소유자 아님: 무시), 순차 읽기 알림 (Readahead 늘림)
+ * - CACHE_DIRECT: 원본, 대상 모두 O_DIRECT로 전환 (하나라도 실패: 되돌리고 CACHE_STREAM)
+ */
+static void beginStreamCopy(CopyState *state) {
+    int srcFlags = fcntl(state->srcFd, F_GETFL);
+    if (srcFlags != -1 && fcntl(state->srcFd, F_SETFL, srcFlags | O_NOATIME) == 0)
+        srcFlags |= O_NOATIME;
+    posix_fadvise(state->srcFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    if (state->cache != CACHE_DIRECT)
+        return;
+
+    int dstFlags = fcntl(state->dstFd, F_GETFL);
+    if (srcFlags != -1 && dstFlags != -1 && fcntl(state->srcFd, F_SETFL, srcFlags | O_DIRECT) == 0) {
+        if (fcntl(state->dstFd, F_SETFL, dstFlags | O_DIRECT) == 0) {
+            state->directAlign = sysconf(_SC_PAGESIZE);  // 논리 Block 크기 (512B, 4KB)의 배수
+            return;
+        }
+        fcntl(state->srcFd, F_SETFL, srcFlags);
+    }
+    state->cache = CACHE_STREAM;
+}
+
+/**
+ * O_DIRECT 해제 (정렬 안 된 위치부터 복사해야 할 때): 이후 CACHE_STREAM으로 복사
+ *
+ * @param state 복사 상태
+ */
+static void endDirectCopy(CopyState *state) {
+    int flags = fcntl(state->srcFd, F_GETFL);
+    if (flags != -1)
+        fcntl(state->srcFd, F_SETFL, flags & ~O_DIRECT);
+    flags = fcntl(state->dstFd, F_GETFL);
+    if (flags != -1)
+        fcntl(state->dstFd, F_SETFL, flags & ~O_DIRECT);
+    state->directAlign = 0;
+    state->cache = CACHE_STREAM;
+}
+
+/**
+ * Streaming 복사: 복사한 구간을 Page Cache에서 제거 (`STREAM_FLUSH_SIZE`마다, CACHE_STREAM만)
+ *
+ * @param state 복사 상태 (pos까지 대상에 씀)
+ * @param isLast 파일 복사 끝 (크기와 상관 없이 정리)
+ *
+ * @details
+ * - 이번 구간: Writeback 시작만 (기다리지 않음)
+ * - 그 전 구간: Writeback 끝날 때까지 대기 후 원본, 대상 모두 제거 (Dirty Page: 제거 안 됨)
+ * - 파일 끝: 마지막 구간은 기다리지 않음 (작은 파일 많은 폴더 복사가 파일마다 대기하지 않게) -> Writeback 끝난 만큼만 제거됨
+ */
+static void releaseCopiedCache(CopyState *state, bool isLast) {
+    if (state->cache != CACHE_STREAM || (!isLast && state->pos - state->flushedPos < STREAM_FLUSH_SIZE))
+        return;
+    if (state->flushedPos > state->droppedPos) {
+        off_t len = state->flushedPos - state->droppedPos;
+        sync_file_range(state->dstFd, state->droppedPos, len, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(state->dstFd, state->droppedPos, len, POSIX_FADV_DONTNEED);
+        posix_fadvise(state->srcFd, state->droppedPos, len, POSIX_FADV_DONTNEED);
+        state->droppedPos = state->flushedPos;
+    }
+    if (state->pos > state->flushedPos) {
+        sync_file_range(state->dstFd, state->flushedPos, state->pos - state->flushedPos, SYNC_FILE_RANGE_WRITE);
+        state->flushedPos = state->pos;
+    }
+    if (isLast) {
+        posix_fadvise(state->dstFd, state->droppedPos, 0, POSIX_FADV_DONTNEED);
+        posix_fadvise(state->srcFd, state->droppedPos, 0, POSIX_FADV_DONTNEED);
+    }
+}
+
+/**
+ * 원본 파일 전체의 Extent 공유 (FICLONE, CoW 파일 시스템에서 크기와 상관 없이 바로 끝남, Hole 유지)
+ *
+ * @param state 복사 상태 (아직 복사 전)
+ * @return 결과 (공유 금지, 지원 X: 데이터 구간 복사 / 공유만 허용인데 지원 X: 실패)
+ */
+static CopyStepResult copyByReflink(CopyState *state) {
+    if (state->reflink == REFLINK_NEVER)
+        return COPY_STEP_UNSUPPORTED;
+#ifdef FICLONE
+    if (checkFileJob(state->fileJob) == -1)  // 취소됨 (일시정지: 재개될 때까지 여기서 대기)
+        return COPY_STEP_FAILED;
+    TRACE_BEGIN(cloneStartUSec);
+    int ret = ioctl(state->dstFd, FICLONE, state->srcFd);
+    TRACE_END(cloneStartUSec, "copyClone");
+    if (ret == 0) {
+        state->copied = state->dataBytes;
+        reportCopied(state->progress, state->fileJob, state->job, state->dataBytes, state->copied, state->dataBytes);
+        return COPY_STEP_DONE;
+    }
+#else
+    errno = EOPNOTSUPP;
 #endif
-    // 불가능할 or 실패 시: read() -> write()로 fallback
-    ssize_t readBytes, writtenBytes, totalWrittenBytes;
-    char buf[COPY_FILE_BUF_SIZE];
+    // 지원 X (CoW 아닌 파일 시스템, 다른 파일 시스템 간 등)
+    if (state->reflink == REFLINK_ALWAYS)
+        return COPY_STEP_FAILED;
+    if (state->job != NULL)
+        __atomic_store_n(&state->job->isReflinkUnsupported, true, __ATOMIC_RELAXED);
+    return COPY_STEP_UNSUPPORTED;
+}
 
+/**
+ * 데이터 구간 복사 방식 1: copy_file_range (Kernel 안에서 복사) COPY_CHUNK_SIZE 단위로 분할 복사, 진행률 갱신
+ *
+ * @param state 복사 상태 ([pos, end) 복사)
+ * @return 결과 (공유 금지, 지원 X, 도중 실패: 복사한 곳부터 다음 방식)
+ */
+static CopyStepResult copyByCopyRange(CopyState *state) {
+    // 공유 금지: 같은 파일 시스템이면 Kernel이 Extent 공유할 수 있음 (Btrfs, XFS 등) -> 사용 X
+    // O_DIRECT: Page Cache를 거쳐 복사됨 -> 사용 X
+    if (state->reflink == REFLINK_NEVER || state->directAlign != 0)
+        return COPY_STEP_UNSUPPORTED;
 #if defined(_GNU_SOURCE) && (__LP64__ || (defined(_FILE_OFFSET_BITS) && _FILE_OFFSET_BITS == 64))
-    while (totalCopied < fileSize) {
-        copied = copy_file_range(srcFd, &offIn, dstFd, &offOut, COPY_CHUNK_SIZE, 0);
-        if (
-            copied == 0  // EOF 만남
-            || copied == -1  // copy_file_range 실패
-        )
-            break;
-        totalCopied += copied;
+    off_t offIn = state->pos, offOut = state->pos;
+
+    while (state->pos < state->end) {
+        if (checkFileJob(state->fileJob) == -1)  // 취소됨 (일시정지: 재개될 때까지 여기서 대기)
+            return COPY_STEP_FAILED;
+        size_t chunk = state->end - state->pos < COPY_CHUNK_SIZE ? state->end - state->pos : COPY_CHUNK_SIZE;
+        TRACE_BEGIN(chunkStartUSec);
+        ssize_t copied = copy_file_range(state->srcFd, &offIn, state->dstFd, &offOut, chunk, 0);
+        TRACE_END(chunkStartUSec, "copyChunk");
+        if (copied == -1)  // copy_file_range 실패 (다른 파일 시스템 조합, 오래된 Kernel 등)
+            return COPY_STEP_UNSUPPORTED;
+        if (copied == 0)  // EOF 만남 (복사 중 원본이 줄어듦)
+            return COPY_STEP_FAILED;
+        state->pos += copied;
+        state->copied += copied;
 
         // 진행률 업데이트
-        pthread_mutex_lock(&progress->flagMutex);
-        progress->flags &= ~PROGRESS_PERCENT_MASK;
-        progress->flags |= (int)((double)totalCopied / fileSize * 100) << PROGRESS_PERCENT_START;
-        pthread_mutex_unlock(&progress->flagMutex);
+        reportCopied(state->progress, state->fileJob, state->job, copied, state->copied, state->dataBytes);
+        releaseCopiedCache(state, false);
     }
-    if (copied != -1) {
-        return (totalCopied == fileSize) ? 0 : -1;
+    return COPY_STEP_DONE;
+#else
+    return COPY_STEP_UNSUPPORTED;
+#endif
+}
+
+/**
+ * 데이터 구간 복사 방식 2: io_uring으로 Chunk 여러 개를 동시에 읽고 씀 (make IO_URING=1, copy_file_range 사용 불가한 경우: 다른 종류의 File System 사이 등), 진행률 갱신
+ *
+ * @param state 복사 상태 ([pos, end) 복사)
+ * @return 결과 (io_uring 사용 불가, O_DIRECT or 도중 실패: 이어서 복사된 곳부터 다음 방식)
+ */
+static CopyStepResult copyByUring(CopyState *state) {
+    if (state->directAlign != 0)  // O_DIRECT: 마지막 Chunk가 정렬 안 된 크기
+        return COPY_STEP_UNSUPPORTED;
+    while (state->pos < state->end) {
+        if (checkFileJob(state->fileJob) == -1)  // 취소됨 (일시정지: 재개될 때까지 여기서 대기)
+            return COPY_STEP_FAILED;
+        TRACE_BEGIN(chunkStartUSec);
+        ssize_t copied = copyRangeUring(state->srcFd, state->dstFd, state->pos, state->end);
+        TRACE_END(chunkStartUSec, "copyChunk");
+        if (copied <= 0)
+            return COPY_STEP_UNSUPPORTED;
+        state->pos += copied;
+        state->copied += copied;
+
+        // 진행률 업데이트
+        reportCopied(state->progress, state->fileJob, state->job, copied, state->copied, state->dataBytes);
+        releaseCopiedCache(state, false);
     }
+    return COPY_STEP_DONE;
+}
+
+/**
+ * 데이터 구간 복사 방식 3: splice()로 Pipe를 거쳐 복사 (사용자 영역 복사 X), 진행률 갱신
+ *
+ * @param state 복사 상태 ([pos, end) 복사, Pipe: 처음 사용 시 생성)
+ * @return 결과 (Pipe 생성 불가, 지원 X, O_DIRECT, 도중 실패: 대상에 쓴 곳부터 다음 방식)
+ */
+static CopyStepResult copyBySplice(CopyState *state) {
+#ifdef _GNU_SOURCE
+    if (state->directAlign != 0)  // O_DIRECT: 정렬 안 된 크기로 나뉘어 써질 수 있음
+        return COPY_STEP_UNSUPPORTED;
+    if (state->pipeFds[0] == -1) {
+        if (pipe2(state->pipeFds, O_CLOEXEC) == -1) {
+            state->pipeFds[0] = state->pipeFds[1] = -1;
+            return COPY_STEP_UNSUPPORTED;
+        }
+        fcntl(state->pipeFds[1], F_SETPIPE_SZ, SPLICE_PIPE_SIZE);  // 실패 (pipe-max-size 초과 등): 기본 크기 사용
+    }
+    int pipeSize = fcntl(state->pipeFds[1], F_GETPIPE_SZ);
+    if (pipeSize <= 0)
+        pipeSize = sysconf(_SC_PAGESIZE);
+    loff_t offIn = state->pos, offOut = state->pos;
+
+    while (state->pos < state->end) {
+        if (checkFileJob(state->fileJob) == -1)  // 취소됨 (일시정지: 재개될 때까지 여기서 대기)
+            return COPY_STEP_FAILED;
+        size_t chunk = state->end - state->pos < pipeSize ? state->end - state->pos : pipeSize;
+        TRACE_BEGIN(chunkStartUSec);
+        ssize_t inPipe = splice(state->srcFd, &offIn, state->pipeFds[1], NULL, chunk, SPLICE_F_MOVE | SPLICE_F_MORE);
+        if (inPipe == -1)  // 원본 쪽 splice 지원 X 등 (Pipe: 비어 있음)
+            return COPY_STEP_UNSUPPORTED;
+        if (inPipe == 0)  // EOF 만남 (복사 중 원본이 줄어듦)
+            return COPY_STEP_FAILED;
+
+        // Pipe에 들어간 만큼 모두 대상에 씀
+        while (inPipe > 0) {
+            ssize_t written = splice(state->pipeFds[0], NULL, state->dstFd, &offOut, inPipe, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if (written <= 0) {  // 대상 쪽 splice 지원 X 등: Pipe에 남은 내용 버리고, 대상에 쓴 곳부터 다음 방식으로
+                close(state->pipeFds[0]);
+                close(state->pipeFds[1]);
+                state->pipeFds[0] = state->pipeFds[1] = -1;
+                return COPY_STEP_UNSUPPORTED;
+            }
+            inPipe -= written;
+            state->pos += written;
+            state->copied += written;
+
+            // 진행률 업데이트
+            reportCopied(state->progress, state->fileJob, state->job, written, state->copied, state->dataBytes);
+        }
+        TRACE_END(chunkStartUSec, "copyChunk");
+        releaseCopiedCache(state, false);
+    }
+    return COPY_STEP_DONE;
+#else
+    return COPY_STEP_UNSUPPORTED;
 #endif
+}
 
-    // copy_file_range 실패 시 -> read-and-write로 fallback
+/**
+ * read() -> write() 복사용 Buffer 가져오기 (남겨 둔 Buffer 중 충분히 큰 가장 작은 것, 없으면: 새로 할당)
+ *
+ * @param size 필요한 크기 (Page 크기의 배수)
+ * @param buf (반환) 가져온 Buffer
+ * @return 성공: 0, 실패: -1
+ */
+static int takeCopyBuffer(size_t size, CopyBuffer *buf) {
+    CopyBuffer *best = NULL;
+
+    lockMutex(&copyBufMutex);
+    for (size_t i = 0; i < COPY_BUF_POOL_SIZE; i++) {
+        CopyBuffer *cur = &copyBufPool[i];
+        if (cur->data != NULL && cur->size >= size && (best == NULL || cur->size < best->size))
+            best = cur;
+    }
+    if (best != NULL) {
+        *buf = *best;
+        best->data = NULL;
+        pthread_mutex_unlock(&copyBufMutex);
+        return 0;
+    }
+    pthread_mutex_unlock(&copyBufMutex);
 
-    // 복사 성공한 위치로 seek()
-    lseek(srcFd, offIn, SEEK_SET);
-    lseek(dstFd, offOut, SEEK_SET);
+    // Page 단위 정렬: Page Cache와의 복사 빠름 (O_DIRECT에도 사용 가능)
+    void *data;
+    if (posix_memalign(&data, sysconf(_SC_PAGESIZE), size) != 0)
+        return -1;
+    buf->data = data;
+    buf->size = size;
+    return 0;
+}
 
-    // 복사 수행
-    while (totalCopied < fileSize) {
-        readBytes = read(srcFd, buf, COPY_FILE_BUF_SIZE);
-        if (readBytes == -1)
+/**
+ * 다 쓴 Buffer 돌려주기 (빈 자리 없으면: 남겨 둔 것 중 가장 작은 Buffer와 비교해 작은 쪽 해제)
+ *
+ * @param buf 다 쓴 Buffer (data가 NULL: 무시)
+ *
+ * @details
+ * - `COPY_BUF_MIN_SIZE`보다 큰 Buffer (회전 디스크용 등): 남겨 두지 않고 바로 해제 -> 복사 끝난 후 계속 차지하는 메모리 제한
+ */
+static void releaseCopyBuffer(CopyBuffer *buf) {
+    if (buf->data == NULL)
+        return;
+    if (buf->size > COPY_BUF_MIN_SIZE) {
+        free(buf->data);
+        buf->data = NULL;
+        return;
+    }
+    CopyBuffer *slot = NULL;
+
+    lockMutex(&copyBufMutex);
+    for (size_t i = 0; i < COPY_BUF_POOL_SIZE; i++) {
+        CopyBuffer *cur = &copyBufPool[i];
+        if (cur->data == NULL) {
+            slot = cur;
+            break;
+        }
+        if (slot == NULL || cur->size < slot->size)
+            slot = cur;
+    }
+    CopyBuffer evicted = { NULL, 0 };
+    if (slot->data == NULL || slot->size < buf->size) {
+        evicted = *slot;
+        *slot = *buf;
+    } else {
+        evicted = *buf;
+    }
+    pthread_mutex_unlock(&copyBufMutex);
+
+    free(evicted.data);
+    buf->data = NULL;
+}
+
+/**
+ * 장치가 회전 디스크 (HDD)인지 확인 (sysfs의 queue/rotational, 마지막 장치는 Cache)
+ *
+ * @param dev 확인할 장치 (st_dev)
+ * @return 회전 디스크: true, 아님 or 확인 불가: false
+ */
+static bool isRotationalDev(dev_t dev) {
+    lockMutex(&copyBufMutex);
+    if (dev == lastBufDev) {
+        bool ret = isLastBufDevRotational;
+        pthread_mutex_unlock(&copyBufMutex);
+        return ret;
+    }
+    pthread_mutex_unlock(&copyBufMutex);
+
+    // 파티션: 상위 (디스크) 폴더에 queue 있음
+    static const char *const rotationalPaths[] = {
+        "/sys/dev/block/%u:%u/queue/rotational",
+        "/sys/dev/block/%u:%u/../queue/rotational"
+    };
+    char path[PATH_MAX];
+    int value = 0;
+    for (size_t i = 0; i < sizeof(rotationalPaths) / sizeof(rotationalPaths[0]); i++) {
+        snprintf(path, PATH_MAX, rotationalPaths[i], major(dev), minor(dev));
+        FILE *fp = fopen(path, "r");
+        if (fp == NULL)
+            continue;
+        if (fscanf(fp, "%d", &value) != 1)
+            value = 0;
+        fclose(fp);
+        break;
+    }
+
+    lockMutex(&copyBufMutex);
+    lastBufDev = dev;
+    isLastBufDevRotational = value == 1;
+    pthread_mutex_unlock(&copyBufMutex);
+    return value == 1;
+}
+
+/**
+ * read() -> write() 복사 Chunk 크기 결정
+ *
+ * @param srcFd 원본 파일 descriptor
+ * @param dstFd 대상 파일 descriptor
+ * @param rangeLen 복사할 데이터 구간 크기
+ * @return Chunk 크기 (Page 크기의 배수)
+ *
+ * @details
+ * - 원본/대상 중 큰 st_blksize x `COPY_BUF_BLOCKS` (`COPY_BUF_MIN_SIZE` ~ `COPY_BUF_MAX_SIZE`)
+ * - 원본이 회전 디스크: `COPY_BUF_MAX_SIZE` (Seek 횟수 최소화)
+ * - 데이터 구간이 더 작으면: 구간 크기 (Page 단위로 올림)
+ */
+static size_t chooseCopyChunk(int srcFd, int dstFd, off_t rangeLen) {
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t chunk = COPY_BUF_MIN_SIZE;
+    struct stat srcStat, dstStat;
+
+    if (fstat(srcFd, &srcStat) == 0) {
+        blksize_t blkSize = srcStat.st_blksize;
+        if (fstat(dstFd, &dstStat) == 0 && dstStat.st_blksize > blkSize)
+            blkSize = dstStat.st_blksize;
+        if (blkSize > 0)
+            chunk = (size_t)blkSize * COPY_BUF_BLOCKS;
+        if (isRotationalDev(srcStat.st_dev))
+            chunk = COPY_BUF_MAX_SIZE;
+    }
+    if (chunk < COPY_BUF_MIN_SIZE)
+        chunk = COPY_BUF_MIN_SIZE;
+    if (chunk > COPY_BUF_MAX_SIZE)
+        chunk = COPY_BUF_MAX_SIZE;
+    if ((size_t)rangeLen < chunk)
+        chunk = rangeLen;
+    return (chunk + pageSize - 1) / pageSize * pageSize;
+}
+
+/**
+ * Buffer 내용을 모두 씀 (일부만 써지면: 나머지 이어서)
+ *
+ * @param fd 대상 파일 descriptor
+ * @param buf 쓸 내용
+ * @param len 쓸 크기
+ * @param offset 쓸 위치
+ * @return 성공: 0, 실패: -1
+ */
+static int writeFull(int fd, const char *buf, size_t len, off_t offset) {
+    while (len > 0) {
+        ssize_t written = pwrite(fd, buf, len, offset);
+        if (written == -1) {
+            if (errno == EINTR)
+                continue;
             return -1;
-        if (readBytes == 0)
+        }
+        buf += written;
+        len -= written;
+        offset += written;
+    }
+    return 0;
+}
+
+/**
+ * 읽기 Thread 함수: 빈 Buffer를 번갈아 원본 내용으로 채움 (구간 끝, EOF, 실패 or 중단 요청까지)
+ *
+ * @param arg 공유 상태 (BufferedCopy)
+ * @return 없음
+ */
+static void *readCopyChunks(void *arg) {
+    BufferedCopy *copy = arg;
+
+    for (int idx = 0; copy->readPos < copy->end; idx ^= 1) {
+        lockMutex(&copy->mutex);
+        while (copy->isFilled[idx] && !copy->isStopped)
+            pthread_cond_wait(&copy->changed, &copy->mutex);
+        if (copy->isStopped) {
+            pthread_mutex_unlock(&copy->mutex);
             break;
-        totalWrittenBytes = 0;
-        while (totalWrittenBytes < readBytes) {
-            writtenBytes = write(dstFd, &buf[totalWrittenBytes], readBytes - totalWrittenBytes);
-            if (writtenBytes == -1)
-                return -1;
-            totalWrittenBytes += writtenBytes;
         }
-        totalCopied += readBytes;
+        pthread_mutex_unlock(&copy->mutex);
+
+        size_t chunk = copy->end - copy->readPos < copy->bufs[idx].size ? copy->end - copy->readPos : copy->bufs[idx].size;
+        chunk = (chunk + copy->align - 1) / copy->align * copy->align;  // O_DIRECT: 끝부분도 정렬된 크기로 (EOF까지만 읽힘)
+        ssize_t readBytes;
+        do {
+            readBytes = pread(copy->srcFd, copy->bufs[idx].data, chunk, copy->readPos);
+        } while (readBytes == -1 && errno == EINTR);
+
+        lockMutex(&copy->mutex);
+        copy->lens[idx] = readBytes;
+        copy->errors[idx] = readBytes == -1 ? errno : 0;
+        copy->isFilled[idx] = true;
+        pthread_cond_broadcast(&copy->changed);
+        pthread_mutex_unlock(&copy->mutex);
+        if (readBytes <= 0)  // 실패 or EOF: 쓰기 Thread가 확인
+            break;
+        copy->readPos += readBytes;
+    }
+    return NULL;
+}
+
+/**
+ * 데이터 구간 복사 방식 4 (마지막): read() -> write()로 복사, 진행률 갱신
+ *
+ * @param state 복사 상태 ([pos, end) 복사)
+ * @return 결과 (다음 방식 없음: 성공 or 실패)
+ *
+ * @details
+ * - Chunk 크기: chooseCopyChunk() 참조, Buffer: Pool에서 가져와 재사용 (Page 단위 정렬)
+ * - 구간이 Chunk보다 크면: 읽기 Thread가 다음 Chunk를 읽는 동안 현재 Chunk를 씀 (Buffer 2개 번갈아 사용)
+ * - 읽기 Thread 생성 실패 or Buffer 1개만 할당 가능: 한 Thread에서 차례로 읽고 씀
+ * - O_DIRECT: 정렬된 크기로 읽고 씀 (마지막 Chunk: 0으로 채워 씀 -> 복사 끝난 후 ftruncate()로 맞춤)
+ */
+static CopyStepResult copyByBuffer(CopyState *state) {
+    if (state->directAlign != 0 && state->pos % state->directAlign != 0)  // 정렬 안 된 위치: O_DIRECT로 읽고 쓸 수 없음
+        endDirectCopy(state);
+    BufferedCopy copy = {
+        .srcFd = state->srcFd,
+        .readPos = state->pos,
+        .end = state->end,
+        .align = state->directAlign != 0 ? state->directAlign : 1
+    };
+    size_t chunk = chooseCopyChunk(state->srcFd, state->dstFd, state->end - state->pos);
+    if (takeCopyBuffer(chunk, &copy.bufs[0]) == -1)
+        return COPY_STEP_FAILED;
+
+    // 읽기 Thread와 겹쳐서 복사 (구간이 Chunk 1개 이하: 겹칠 것 없음)
+    pthread_t reader;
+    bool isThreaded = false;
+    if (state->end - state->pos > (off_t)chunk && takeCopyBuffer(chunk, &copy.bufs[1]) == 0) {
+        pthread_mutex_init(&copy.mutex, NULL);
+        pthread_cond_init(&copy.changed, NULL);
+        isThreaded = pthread_create(&reader, NULL, readCopyChunks, &copy) == 0;
+        if (!isThreaded) {
+            pthread_cond_destroy(&copy.changed);
+            pthread_mutex_destroy(&copy.mutex);
+            releaseCopyBuffer(&copy.bufs[1]);
+        }
+    }
+
+    CopyStepResult ret = COPY_STEP_DONE;
+    for (int idx = 0; state->pos < state->end; idx = isThreaded ? idx ^ 1 : 0) {
+        if (checkFileJob(state->fileJob) == -1) {  // 취소됨 (일시정지: 재개될 때까지 여기서 대기)
+            ret = COPY_STEP_FAILED;
+            break;
+        }
+
+        // 읽은 Chunk 받기 (Thread 없음: 직접 읽음)
+        ssize_t readBytes;
+        if (isThreaded) {
+            lockMutex(&copy.mutex);
+            while (!copy.isFilled[idx])
+                pthread_cond_wait(&copy.changed, &copy.mutex);
+            readBytes = copy.lens[idx];
+            if (readBytes == -1)
+                errno = copy.errors[idx];
+            pthread_mutex_unlock(&copy.mutex);
+        } else {
+            size_t len = state->end - state->pos < copy.bufs[0].size ? state->end - state->pos : copy.bufs[0].size;
+            len = (len + copy.align - 1) / copy.align * copy.align;
+            do {
+                readBytes = pread(state->srcFd, copy.bufs[0].data, len, state->pos);
+            } while (readBytes == -1 && errno == EINTR);
+        }
+        if (readBytes <= 0) {  // 실패 or EOF 만남 (복사 중 원본이 줄어듦)
+            ret = COPY_STEP_FAILED;
+            break;
+        }
+
+        size_t writeLen = (readBytes + copy.align - 1) / copy.align * copy.align;
+        memset(copy.bufs[idx].data + readBytes, 0, writeLen - readBytes);
+        TRACE_BEGIN(chunkStartUSec);
+        if (writeFull(state->dstFd, copy.bufs[idx].data, writeLen, state->pos) == -1) {
+            ret = COPY_STEP_FAILED;
+            break;
+        }
+        TRACE_END(chunkStartUSec, "copyChunk");
+        state->pos += readBytes;
+        state->copied += readBytes;
+
+        // 다 쓴 Buffer: 읽기 Thread에 돌려줌
+        if (isThreaded) {
+            lockMutex(&copy.mutex);
+            copy.isFilled[idx] = false;
+            pthread_cond_broadcast(&copy.changed);
+            pthread_mutex_unlock(&copy.mutex);
+        }
 
         // 진행률 업데이트
-        pthread_mutex_lock(&progress->flagMutex);
-        progress->flags &= ~PROGRESS_PERCENT_MASK;
-        progress->flags |= (int)((double)totalCopied / fileSize * 100) << PROGRESS_PERCENT_START;
-        pthread_mutex_unlock(&progress->flagMutex);
+        reportCopied(state->progress, state->fileJob, state->job, readBytes, state->copied, state->dataBytes);
+        releaseCopiedCache(state, false);
+    }
+
+    if (isThreaded) {
+        int savedErrno = errno;
+        lockMutex(&copy.mutex);
+        copy.isStopped = true;
+        pthread_cond_broadcast(&copy.changed);
+        pthread_mutex_unlock(&copy.mutex);
+        pthread_join(reader, NULL);
+        pthread_cond_destroy(&copy.changed);
+        pthread_mutex_destroy(&copy.mutex);
+        releaseCopyBuffer(&copy.bufs[1]);
+        errno = savedErrno;
+    }
+    releaseCopyBuffer(&copy.bufs[0]);
+    return ret;
+}
+
+/**
+ * pos 이후 첫 데이터 구간 찾기 (SEEK_DATA/SEEK_HOLE, 지원 X: 나머지 전체를 데이터로 취급)
+ *
+ * @param fd 원본 파일 descriptor
+ * @param pos 찾기 시작할 위치
+ * @param fileSize 원본 파일 크기
+ * @param start (반환) 데이터 구간 시작
+ * @param end (반환) 데이터 구간 끝
+ * @return 찾음: true, 더 이상 데이터 없음: false
+ */
+static bool findDataRange(int fd, off_t pos, off_t fileSize, off_t *start, off_t *end) {
+    if (pos >= fileSize)
+        return false;
+    *start = lseek(fd, pos, SEEK_DATA);
+    if (*start == -1) {
+        if (errno == ENXIO)  // pos 이후: 모두 Hole
+            return false;
+        *start = pos;  // Hole 확인 불가
+        *end = fileSize;
+        return true;
+    }
+    if (*start >= fileSize)
+        return false;
+    *end = lseek(fd, *start, SEEK_HOLE);
+    if (*end == -1 || *end > fileSize)
+        *end = fileSize;
+    return true;
+}
+
+/**
+ * Extent 공유 시도 후, 데이터 구간만 복사 방식들을 빠른 순서대로 시도 (사용 불가: 복사한 곳부터 다음 방식이 이어서 복사)
+ *
+ * @param srcFd 원본 파일 descriptor
+ * @param dstFd 대상 파일 descriptor (빈 파일)
+ * @param fileSize 원본 파일 크기
+ * @param progress 진행 상태 구조체
+ * @param fileJob 취소, 일시정지 확인할 파일 작업 (Chunk 사이마다 확인, Extent 공유 여부: 작업 내용 따름)
+ * @param job 참여 중인 폴더 복사 (NULL: 파일 1개 복사)
+ * @return 성공: 0, 실패 or 취소됨: -1
+ *
+ * @details
+ * - 순서: Extent 공유 (FICLONE) -> 데이터 구간마다 copy_file_range -> io_uring (make IO_URING=1) -> splice -> read/write
+ * - Hole: 복사하지 않고 건너뜀 (대상도 Hole로 남음, 마지막 Hole: 크기만 맞춤) -> 진행률도 데이터 구간 크기 기준
+ * - Page Cache 사용 방식 (작업 내용 따름): beginStreamCopy(), releaseCopiedCache() 참조
+ */
+static int doCopyFile(int srcFd, int dstFd, size_t fileSize, FileProgressInfo *progress, FileJob *fileJob, CopyJob *job) {
+    static CopyStepResult (*const copySteps[])(CopyState *) = {
+        copyByCopyRange,
+        copyByUring,  // splice보다 먼저: splice는 일반 파일에서 거의 항상 성공 -> 뒤에 두면 사용되지 않음
+        copyBySplice,
+        copyByBuffer
+    };
+    size_t stepIdx = 0;  // 앞 구간에서 사용 불가했던 방식: 다시 시도 X
+    off_t start, end;
+    CopyState state = {
+        .srcFd = srcFd,
+        .dstFd = dstFd,
+        .fileSize = fileSize,
+        .progress = progress,
+        .fileJob = fileJob,
+        .job = job,
+        .reflink = fileJob != NULL ? fileJob->task.reflink : REFLINK_AUTO,
+        .cache = fileJob != NULL ? fileJob->task.cache : CACHE_NORMAL,
+        .pipeFds = { -1, -1 }
+    };
+    int ret = 0;
+
+    // 진행률 기준: 데이터 구간 크기 합 (폴더 복사: 펼칠 때 할당된 크기로 이미 더함)
+    for (off_t pos = 0; findDataRange(srcFd, pos, fileSize, &start, &end); pos = end)
+        state.dataBytes += end - start;
+    if (fileJob != NULL && job == NULL)
+        __atomic_store_n(&fileJob->totalBytes, state.dataBytes, __ATOMIC_RELAXED);
+
+    switch (copyByReflink(&state)) {
+        case COPY_STEP_DONE:
+            return 0;
+        case COPY_STEP_FAILED:
+            return -1;
+        case COPY_STEP_UNSUPPORTED:
+            break;  // 데이터 구간 복사
+    }
+    if (state.cache != CACHE_NORMAL)
+        beginStreamCopy(&state);
+
+    for (off_t pos = 0; ret == 0 && findDataRange(srcFd, pos, fileSize, &start, &end); pos = end) {
+        state.pos = start;
+        state.end = end;
+        while (1) {
+            if (stepIdx >= sizeof(copySteps) / sizeof(copySteps[0])) {
+                ret = -1;
+                break;
+            }
+            CopyStepResult result = copySteps[stepIdx](&state);
+            if (result == COPY_STEP_FAILED)
+                ret = -1;
+            if (result != COPY_STEP_UNSUPPORTED)
+                break;
+            stepIdx++;  // 다음 방식으로 계속
+        }
+    }
+    if (state.pipeFds[0] != -1) {
+        close(state.pipeFds[0]);
+        close(state.pipeFds[1]);
+    }
+
+    // 끝부분 Hole: 크기만 맞춤 (중간 Hole: 건너뛰어 쓴 곳 -> 이미 Hole, O_DIRECT: 정렬하려고 더 쓴 부분 잘라냄)
+    if (ret == 0)
+        ret = ftruncate(dstFd, fileSize);
+    if (ret == 0)
+        releaseCopiedCache(&state, true);
+    return ret;
+}
+
+/**
+ * 폴더 생성 후 원본, 대상 폴더 열기 (하위 항목 수는 펼칠 때 설정)
+ *
+ * @param srcParentFd 원본의 상위 폴더
+ * @param srcName 원본 폴더 이름
+ * @param dstParentFd 대상의 상위 폴더
+ * @param dstName 만들 폴더 이름
+ * @param mode 만들 폴더 권한
+ * @return 열린 폴더, 실패: NULL
+ */
+static CopyDir *openCopyDir(int srcParentFd, const char *srcName, int dstParentFd, const char *dstName, mode_t mode) {
+    if (mkdirat(dstParentFd, dstName, mode) == -1)  // 폴더 생성 실패 -> 내용물 복사 불가
+        return NULL;
+
+    CopyDir *dir = malloc(sizeof(CopyDir));
+    if (dir == NULL)
+        return NULL;
+    int srcFd = openat(srcParentFd, srcName, directoryOpenArgs);
+    if (srcFd == -1) {
+        free(dir);
+        return NULL;
+    }
+    dir->dstFd = openat(dstParentFd, dstName, directoryOpenArgs);
+    if (dir->dstFd == -1) {
+        close(srcFd);
+        free(dir);
+        return NULL;
+    }
+    dir->srcDir = fdopendir(srcFd);
+    if (dir->srcDir == NULL) {
+        close(srcFd);
+        close(dir->dstFd);
+        free(dir);
+        return NULL;
+    }
+    dir->refs = 0;
+    return dir;
+}
+
+/**
+ * 하위 항목 1개 끝남: 마지막이면 폴더 닫음
+ *
+ * @param dir 항목이 있던 폴더
+ */
+static void releaseCopyDir(CopyDir *dir) {
+    if (__atomic_sub_fetch(&dir->refs, 1, __ATOMIC_ACQ_REL) != 0)
+        return;
+    closedir(dir->srcDir);
+    close(dir->dstFd);
+    free(dir);
+}
+
+/**
+ * 폴더의 하위 항목들을 대기 항목으로 추가, 필요하면 다른 Thread에 도움 요청
+ *
+ * @param job 폴더 복사 작업
+ * @param dir 펼칠 폴더 (하위 항목 없으면: 닫음)
+ */
+static void expandCopyDir(CopyJob *job, CopyDir *dir) {
+    CopyItem *head = NULL, *tail = NULL;
+    unsigned int itemCnt = 0;
+    uint64_t dirBytes = 0;
+    struct stat entryStat;
+    int srcFd = dirfd(dir->srcDir);
+
+    // 하위 항목 목록: 작업 Mutex 없이 만든 후 한 번에 추가
+    for (struct dirent *entry = readdir(dir->srcDir); entry != NULL; entry = readdir(dir->srcDir)) {
+        if (
+            ((entry->d_name[0] == '.') && (entry->d_name[1] == '\0')) || ((entry->d_name[0] == '.') && (entry->d_name[1] == '.') && (entry->d_name[2] == '\0'))
+        )  // '.', '..' 건너뜀
+            continue;
+
+        size_t nameLen = strlen(entry->d_name);
+        CopyItem *item = malloc(sizeof(CopyItem) + nameLen + 1);
+        if (item == NULL) {
+            __atomic_store_n(&job->isFailed, true, __ATOMIC_RELAXED);
+            continue;
+        }
+        item->next = NULL;
+        item->parent = dir;
+        memcpy(item->name, entry->d_name, nameLen + 1);
+
+        if (tail == NULL)
+            head = item;
+        else
+            tail->next = item;
+        tail = item;
+    }
+
+    // 파일 크기 확인 필요 -> 항목마다 stat() 호출 필요 (io_uring 사용 가능: `URING_ENTRIES`개씩 묶어 statx())
+    CopyItem **link = &head;
+    tail = NULL;
+    while (*link != NULL) {
+        CopyItem *batch[URING_ENTRIES];
+        const char *names[URING_ENTRIES];
+        struct statx stats[URING_ENTRIES];
+        int errors[URING_ENTRIES];
+        size_t batchCnt = 0;
+        for (CopyItem *item = *link; item != NULL && batchCnt < URING_ENTRIES; item = item->next) {
+            batch[batchCnt] = item;
+            names[batchCnt++] = item->name;
+        }
+        bool isBatched = statFilesUring(srcFd, names, stats, errors, batchCnt) == 0;
+
+        for (size_t i = 0; i < batchCnt; i++) {
+            CopyItem *item = batch[i];
+            uint64_t allocated;
+            if (isBatched && errors[i] == 0) {
+                item->mode = stats[i].stx_mode;
+                item->fileSize = stats[i].stx_size;
+                allocated = stats[i].stx_blocks * 512;
+            } else if (fstatat(srcFd, item->name, &entryStat, AT_SYMLINK_NOFOLLOW) == 0) {  // io_uring 사용 불가 or 실패 (오래된 Kernel 등): 직접 확인
+                item->mode = entryStat.st_mode;
+                item->fileSize = entryStat.st_size;
+                allocated = (uint64_t)entryStat.st_blocks * 512;
+            } else {  // 확인 불가: 목록에서 뺌
+                *link = item->next;
+                free(item);
+                __atomic_store_n(&job->isFailed, true, __ATOMIC_RELAXED);
+                continue;
+            }
+            item->isSparse = allocated < item->fileSize;
+            if (S_ISREG(item->mode))  // 할당된 크기만 (Sparse 파일: Hole 복사 X)
+                dirBytes += item->isSparse ? allocated : item->fileSize;
+
+            tail = item;
+            link = &item->next;
+            itemCnt++;
+        }
+    }
+    if (itemCnt == 0) {  // 빈 폴더: 바로 닫음
+        dir->refs = 1;
+        releaseCopyDir(dir);
+        return;
+    }
+    dir->refs = itemCnt;  // 아직 다른 Thread에 보이지 않음 -> 그냥 써도 됨
+    if (job->fileJob != NULL)
+        __atomic_add_fetch(&job->fileJob->totalBytes, dirBytes, __ATOMIC_RELAXED);
+
+    // 대기 항목으로 추가: 참여 Thread가 상한보다 적으면 도움 요청
+    lockMutex(&job->mutex);
+    tail->next = job->items;
+    job->items = head;
+    job->pending += itemCnt;
+    unsigned int helpCnt = 0;
+    if (job->workers + job->helpWanted < COPY_JOB_MAX_WORKERS) {
+        helpCnt = COPY_JOB_MAX_WORKERS - job->workers - job->helpWanted;
+        if (helpCnt > itemCnt)
+            helpCnt = itemCnt;
+        job->helpWanted += helpCnt;
+    }
+    pthread_cond_broadcast(&job->changed);
+    pthread_mutex_unlock(&job->mutex);
+    if (helpCnt > 0)
+        requestFileJobHelp(job->fileJob, helpCnt);
+}
+
+/**
+ * 대기 항목 1개 복사 (폴더: 만든 후 하위 항목 추가)
+ *
+ * @param job 폴더 복사 작업
+ * @param item 복사할 항목 (처리 후 해제)
+ * @return 성공: 0, 실패: -1
+ */
+static int copyItem(CopyJob *job, CopyItem *item) {
+    int ret = -1;
+    int srcParentFd = dirfd(item->parent->srcDir);
+    int dstParentFd = item->parent->dstFd;
+
+    switch (checkFileJob(job->fileJob) == -1 ? 0 : item->mode & S_IFMT) {  // 취소됨: 남은 항목 건너뜀
+        case S_IFREG:
+            int srcFd = openat(srcParentFd, item->name, O_RDONLY);
+            if (srcFd == -1)
+                break;
+            int dstFd = openat(dstParentFd, item->name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (dstFd == -1) {
+                close(srcFd);
+                break;
+            }
+            ret = doCopyFile(srcFd, dstFd, item->fileSize, job->progress, job->fileJob, job);
+            close(srcFd);
+            close(dstFd);
+            if (ret == -1)
+                unlinkat(dstParentFd, item->name, 0);
+            break;
+        case S_IFDIR:
+            // 폴더 먼저 생성 -> 하위 항목은 그 후에 대기 항목으로 추가됨
+            CopyDir *dir = openCopyDir(srcParentFd, item->name, dstParentFd, item->name, item->mode);
+            if (dir == NULL)
+                break;
+            expandCopyDir(job, dir);
+            ret = 0;
+            break;
+        default:
+            // 다른 종류: 지원 X
+            break;
     }
+    if (ret == -1)
+        __atomic_store_n(&job->isFailed, true, __ATOMIC_RELAXED);
+
+    releaseCopyDir(item->parent);
+    free(item);
+    return ret;
+}
 
-    return (totalCopied == fileSize) ? 0 : -1;
+/**
+ * io_uring으로 다른 작은 파일들과 묶어 복사할 수 있는 항목인지 확인
+ *
+ * @param job 폴더 복사 작업
+ * @param item 확인할 항목
+ * @return 묶을 수 있음: true (io_uring 빼고 빌드: 항상 false)
+ *
+ * @details
+ * - `URING_BUF_SIZE` 이하 일반 파일, Hole 없음 (묶음 복사: Hole도 씀)
+ * - Extent 공유 금지 or 안 되는 것 확인된 작업만 (묶음 복사: FICLONE 시도 X)
+ * - Page Cache 그대로 사용하는 작업만
+ */
+static bool isUringBatchable(CopyJob *job, CopyItem *item) {
+#ifdef USE_IO_URING
+    if (!S_ISREG(item->mode) || item->fileSize > URING_BUF_SIZE || item->isSparse)
+        return false;
+    if (job->fileJob != NULL && job->fileJob->task.cache != CACHE_NORMAL)  // Streaming 복사: 파일마다 Cache 정리 필요
+        return false;
+    switch (job->fileJob != NULL ? job->fileJob->task.reflink : REFLINK_AUTO) {
+        case REFLINK_NEVER:
+            return true;
+        case REFLINK_AUTO:
+            return __atomic_load_n(&job->isReflinkUnsupported, __ATOMIC_RELAXED);
+        default:
+            return false;
+    }
+#else
+    return false;
+#endif
 }
 
 /**
- * (공통 기능 함수) 파일/폴더 복사 수행 (폴더: 재귀호출로 복사)
+ * 작은 파일 여러 개를 io_uring으로 묶어 복사 (실패한 파일, io_uring 사용 불가: copyItem()으로 하나씩 복사)
+ *
+ * @param job 폴더 복사 작업
+ * @param items 복사할 항목들 (isUringBatchable(), 처리 후 해제)
+ * @param cnt 항목 수 (최대 `URING_COPY_DEPTH`)
+ * @return 모두 성공: 0, 1개 이상 실패: -1
+ */
+static int copyItemsUring(CopyJob *job, CopyItem **items, size_t cnt) {
+    UringFileCopy files[URING_COPY_DEPTH];
+    int ret = 0;
+
+    for (size_t i = 0; i < cnt; i++) {
+        files[i].srcDirFd = dirfd(items[i]->parent->srcDir);
+        files[i].dstDirFd = items[i]->parent->dstFd;
+        files[i].name = items[i]->name;
+        files[i].fileSize = items[i]->fileSize;
+        files[i].result = -1;
+    }
+    if (checkFileJob(job->fileJob) == 0) {  // 취소됨: copyItem()에서 건너뜀
+        TRACE_BEGIN(batchStartUSec);
+        if (copyFilesUring(files, cnt) == -1) {
+            for (size_t i = 0; i < cnt; i++)
+                files[i].result = -1;
+        }
+        TRACE_END(batchStartUSec, "copyBatch");
+    }
+
+    for (size_t i = 0; i < cnt; i++) {
+        if (files[i].result == -1) {  // 하나씩 다시 복사 (대상: O_TRUNC로 다시 만듦)
+            if (copyItem(job, items[i]) == -1)
+                ret = -1;
+            continue;
+        }
+        reportCopied(job->progress, job->fileJob, job, files[i].fileSize, files[i].fileSize, files[i].fileSize);
+        releaseCopyDir(items[i]->parent);
+        free(items[i]);
+    }
+    return ret;
+}
+
+/**
+ * 대기 항목이 없을 때까지 가져와 처리
+ *
+ * @param job 참여한 폴더 복사 작업
+ * @param isOwner 작업 받은 Thread 여부 (true: 다른 Thread가 처리 중인 항목까지 모두 끝날 때까지 대기)
+ * @return 처리한 항목 모두 성공: 0, 1개 이상 실패: -1
+ */
+static int runCopyItems(CopyJob *job, bool isOwner) {
+    int ret = 0;
+
+    lockMutex(&job->mutex);
+    while (1) {
+        CopyItem *item = job->items;
+        if (item == NULL) {
+            if (!isOwner || job->pending == 0)
+                break;
+            pthread_cond_wait(&job->changed, &job->mutex);  // 다른 Thread가 폴더 펼치는 중: 하위 항목 추가 or 작업 끝 대기
+            continue;
+        }
+        job->items = item->next;
+
+        // 작은 파일: 바로 뒤의 작은 파일들과 묶어 복사
+        CopyItem *batch[URING_COPY_DEPTH];
+        size_t batchCnt = 0;
+        if (isUringBatchable(job, item)) {
+            batch[batchCnt++] = item;
+            while (batchCnt < URING_COPY_DEPTH && job->items != NULL && isUringBatchable(job, job->items)) {
+                batch[batchCnt++] = job->items;
+                job->items = job->items->next;
+            }
+        }
+        pthread_mutex_unlock(&job->mutex);
+
+        if (batchCnt > 0 ? copyItemsUring(job, batch, batchCnt) == -1 : copyItem(job, item) == -1)
+            ret = -1;
+
+        lockMutex(&job->mutex);
+        job->pending -= batchCnt > 0 ? batchCnt : 1;
+        if (job->pending == 0)
+            pthread_cond_broadcast(&job->changed);
+    }
+    if (!isOwner) {
+        job->workers--;
+        pthread_cond_broadcast(&job->changed);
+    }
+    pthread_mutex_unlock(&job->mutex);
+    return ret;
+}
+
+/**
+ * 폴더 복사: 하위 항목들을 참여한 File Operator Thread들이 나눠 처리
+ *
+ * @param src 원본 폴더
+ * @param dst 대상 폴더
+ * @param progress 진행 상태 구조체 (참여 Thread 모두 여기에 합산)
+ * @param fileJob 취소, 일시정지 확인할 파일 작업
+ * @return 성공: 0, 실패 or 취소됨: -1
+ *
+ * @details
+ * - 폴더는 만든 후에 하위 항목을 대기 항목으로 추가 -> 항상 상위 폴더가 먼저 생성됨
+ * - 작업 1개에 참여하는 Thread 수: 최대 `COPY_JOB_MAX_WORKERS`
+ */
+static int copyTree(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *fileJob) {
+    CopyJob job = {
+        .workers = 1,
+        .progress = progress,
+        .fileJob = fileJob
+    };
+
+    CopyDir *root = openCopyDir(src->dirFd, src->name, dst->dirFd, dst->name, src->mode);
+    if (root == NULL)
+        return -1;
+    pthread_mutex_init(&job.mutex, NULL);
+    pthread_cond_init(&job.changed, NULL);
+
+    // 진행 중인 작업으로 등록: 도움 요청 받은 Thread가 찾을 수 있게
+    lockMutex(&copyJobsMutex);
+    job.next = copyJobs;
+    copyJobs = &job;
+    pthread_mutex_unlock(&copyJobsMutex);
+
+    expandCopyDir(&job, root);
+    runCopyItems(&job, true);
+
+    // 등록 해제 후, 참여 중인 Thread가 모두 떠날 때까지 대기 (job: 이 함수의 지역 변수)
+    lockMutex(&copyJobsMutex);
+    for (CopyJob **prev = &copyJobs; *prev != NULL; prev = &(*prev)->next) {
+        if (*prev == &job) {
+            *prev = job.next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&copyJobsMutex);
+    lockMutex(&job.mutex);
+    job.helpWanted = 0;
+    while (job.workers > 1)
+        pthread_cond_wait(&job.changed, &job.mutex);
+    pthread_mutex_unlock(&job.mutex);
+
+    pthread_cond_destroy(&job.changed);
+    pthread_mutex_destroy(&job.mutex);
+    return job.isFailed ? -1 : 0;
+}
+
+/**
+ * (공통 기능 함수) 파일/폴더 복사 수행 (폴더: 여러 Thread가 나눠 복사)
  *
  * @param src 원본 파일
  * @param dst 대상 폴더
  * @param progress 진행 상태 구조체
- * @return 성공: 0, 실패: -1
+ * @param job 취소, 일시정지 확인할 파일 작업
+ * @return 성공: 0, 실패 or 취소됨: -1
  */
-static inline int doCopy(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress) {
+static inline int doCopy(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *job) {
     int ret;
     switch (src->mode & S_IFMT) {
         case S_IFREG:
@@ -131,79 +1334,52 @@ static inline int doCopy(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *pro
                 close(srcFd);
                 return -1;
             }
-            ret = doCopyFile(srcFd, dstFd, src->fileSize, progress);
+            ret = doCopyFile(srcFd, dstFd, src->fileSize, progress, job, NULL);
             close(srcFd);
             close(dstFd);
             if (ret == -1)
                 unlinkat(dst->dirFd, dst->name, 0);
             return ret;
         case S_IFDIR:
-            // 폴더 -> 재귀적으로 복사
-            if (mkdirat(dst->dirFd, dst->name, src->mode) == -1)  // 폴더 생성 실패 -> 내용물 복사 불가
-                return -1;
-
-            // 필요한 Descriptor open()
-            int srcDirFd = openat(src->dirFd, src->name, directoryOpenArgs);
-            if (srcDirFd == -1)
-                return -1;
-            int dstDirFd = openat(dst->dirFd, dst->name, directoryOpenArgs);
-            if (dstDirFd == -1) {
-                close(srcDirFd);
-                return -1;
-            }
-            DIR *srcDir = fdopendir(srcDirFd);
-            if (srcDir == NULL) {
-                close(srcDirFd);
-                close(dstDirFd);
-                return -1;
-            }
-
-            // 하위 항목 재귀적으로 복사
-            bool failed = false;
-            SrcDstInfo childSrc, childDst;
-            struct stat entryStat;
-            for (struct dirent *entry = readdir(srcDir); entry != NULL; entry = readdir(srcDir)) {
-                if (
-                    ((entry->d_name[0] == '.') && (entry->d_name[1] == '\0')) || ((entry->d_name[0] == '.') && (entry->d_name[1] == '.') && (entry->d_name[2] == '\0'))
-                )  // '.', '..' 건너뜀
-                    continue;
-
-                // 파일 크기 확인 필요 -> 항상 stat() 호출 필요
-                if (fstatat(srcDirFd, entry->d_name, &entryStat, AT_SYMLINK_NOFOLLOW) == -1) {
-                    failed = true;
-                    continue;
-                }
-                childSrc.devNo = -1;  // 이 함수에서는 미사용
-                childSrc.mode = entryStat.st_mode;
-                childSrc.dirFd = srcDirFd;
-                strcpy(childSrc.name, entry->d_name);
-                childSrc.fileSize = entryStat.st_size;
-
-                childDst = childSrc;  // 나머지 정보는 같음
-                childDst.dirFd = dstDirFd;  // 목적지 폴더 설정
-                if (doCopy(&childSrc, &childDst, progress) == -1) {  // 하위 Item 대해 Recursive하게 복사 시도
-                    failed = true;
-                }
-            }
-            closedir(srcDir);
-            close(dstDirFd);
-            if (failed)
-                return -1;
-            return 0;
+            // 폴더 -> 하위 항목 단위로 나눠 복사
+            return copyTree(src, dst, progress, job);
         default:
             // 다른 종류: 지원 X
             return -1;
     }
 }
 
-int copyFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress) {
+int helpCopyJob(void) {
+    CopyJob *job;
+
+    // 도움 요청한 작업 찾아 참여 (등록 해제 전에 참여 -> 작업 끝날 때까지 job 유효)
+    lockMutex(&copyJobsMutex);
+    for (job = copyJobs; job != NULL; job = job->next) {
+        lockMutex(&job->mutex);
+        if (job->helpWanted > 0) {
+            job->helpWanted--;
+            job->workers++;
+            pthread_mutex_unlock(&job->mutex);
+            break;
+        }
+        pthread_mutex_unlock(&job->mutex);
+    }
+    pthread_mutex_unlock(&copyJobsMutex);
+
+    if (job == NULL)  // 이미 끝났거나 다른 Thread가 참여함
+        return 0;
+    return runCopyItems(job, false);
+}
+#pragma GCC diagnostic pop
+
+int copyFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *job) {
     FILEOP_SET_OPERATION(progress, src->name, PROGRESS_OP_CP);
-    int ret = doCopy(src, dst, progress);
+    int ret = doCopy(src, dst, progress, job);
     FILEOP_SET_RESULT(progress, PROGRESS_PREV_CP, ret == -1);
     return ret;
 }
 
-int moveFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress) {
+int moveFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *job) {
     FILEOP_SET_OPERATION(progress, src->name, PROGRESS_OP_MV);
 
     // 같은 디바이스면 rename
@@ -212,8 +1388,14 @@ int moveFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress) {
         return 0;
     }
 
+    // 우선순위 HIGH (같은 장치)로 실행 중: 복사는 오래 걸림 -> LOW로 다시 대기 (이름 변경 전용 Thread 비움)
+    if (requeueFileJob(job) == 0) {
+        FILEOP_CLEAR_OPERATION(progress, PROGRESS_OP_MV);  // 이 Thread에서는 끝남 (결과: 이어서 실행한 Thread가 기록)
+        return 1;
+    }
+
     // 다른 디바이스면, 혹은 윗 단계 실패 시: 복사 시도
-    int ret = doCopy(src, dst, progress);
+    int ret = doCopy(src, dst, progress, job);
     if (ret == 0)
         ret = removeFile(src, progress);  // 성공 시: 원본 삭제 (아래 함수 사용)
     FILEOP_SET_RESULT(progress, PROGRESS_PREV_MV, ret == -1);
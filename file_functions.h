@@ -2,6 +2,7 @@
 #define _FILE_FUNCTIONS_H_INCLUDED_
 
 #include "file_operator.h"
+#include "job_queue.h"
 
 /**
  * 파일/폴더 복사
@@ -9,9 +10,10 @@
  * @param src 원본 파일
  * @param dst 대상 폴더
  * @param progress 진행 상태 구조체
- * @return 성공: 0, 실패: -1
+ * @param job 실행 중인 파일 작업 (복사 Chunk 사이마다 취소, 일시정지 확인)
+ * @return 성공: 0, 실패 or 취소됨: -1
  */
-int copyFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress);
+int copyFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *job);
 
 /**
  * 파일/폴더 이동
@@ -19,9 +21,10 @@ int copyFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress);
  * @param src 원본 파일
  * @param dst 대상 폴더
  * @param progress 진행 상태 구조체
- * @return 성공: 0, 실패: -1
+ * @param job 실행 중인 파일 작업 (다른 장치: 복사 Chunk 사이마다 취소, 일시정지 확인)
+ * @return 성공: 0, 실패 or 취소됨: -1, 복사로 바뀌어 우선순위 LOW로 다시 대기함: 1 (작업 끝난 것 아님)
  */
-int moveFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress);
+int moveFile(SrcDstInfo *src, SrcDstInfo *dst, FileProgressInfo *progress, FileJob *job);
 
 /**
  * 파일/폴더 삭제
@@ -41,4 +44,14 @@ int removeFile(SrcDstInfo *src, FileProgressInfo *progress);
  */
 int makeDirectory(SrcDstInfo *src, FileProgressInfo *progress);
 
+/**
+ * 도움 요청한 폴더 복사 작업 1개에 참여 (대기 항목 없어지면 반환)
+ *
+ * @return 처리한 항목 모두 성공 or 참여할 작업 없음: 0, 1개 이상 실패: -1
+ *
+ * @details
+ * - 진행률: 작업 받은 Thread의 진행 상태에 합산 (참여한 Thread의 진행 상태는 그대로)
+ */
+int helpCopyJob(void);
+
 #endif
@@ -7,19 +7,30 @@
 #include "config.h"
 #include "file_functions.h"
 #include "file_operator.h"
+#include "job_queue.h"
 #include "thread_commons.h"
+#include "trace.h"
+#include "uring_copy.h"
 
 
 static unsigned int threadCnt = 0;  // 생성된 Thread 개수
 
 int fileOperator(void *argsPtr);
 
+/**
+ * (Thread의 onInit 함수) Trace에 표시할 Thread 이름 등록
+ *
+ * @param argsPtr thread의 runtime 정보 (사용 X)
+ * @return 0
+ */
+static int initFileOperator(void *argsPtr);
+
 
 int startFileOperator(pthread_t *newThread, FileOperatorArgs *args) {
     if (threadCnt >= MAX_FILE_OPERATORS)
         return -1;
     if (startThread(
-            newThread, NULL, fileOperator, NULL,
+            newThread, initFileOperator, fileOperator, NULL,
             0, &args->commonArgs, args
         ) == -1) {
         return -1;
@@ -27,48 +38,57 @@ int startFileOperator(pthread_t *newThread, FileOperatorArgs *args) {
     return ++threadCnt;
 }
 
+int initFileOperator(void *argsPtr) {
+    traceThreadName("fileop");
+    return 0;
+}
+
 int fileOperator(void *argsPtr) {
     FileOperatorArgs *args = (FileOperatorArgs *)argsPtr;
-    FileTask command;
+    FileJob *job;
+    FileTask *command;
+    int opRet = 0;  // 작업 결과 (실패: -1 -> Thread 통계의 오류로 기록)
+    int opErrno;
 
-    pthread_mutex_lock(args->pipeReadMutex);
-    int ret = read(args->pipeEnd, &command, sizeof(FileTask));
-    pthread_mutex_unlock(args->pipeReadMutex);
-    switch (ret) {
-        case 0:  // EOF: Write End가 Close됨 -> 종료
+    // 새 작업 or 폴더 복사 도움 요청 대기
+    switch (takeFileJob(args->progressInfo, &job)) {
+        case FILE_WORK_STOP:  // Queue 닫힘, 남은 작업 없음 -> 종료
+            closeUringCopy();
             pthread_mutex_lock(&args->commonArgs.statusMutex);
             args->commonArgs.statusFlags |= THREAD_FLAG_STOP;
             pthread_mutex_unlock(&args->commonArgs.statusMutex);
             return 0;
-        case sizeof(FileTask):  // 성공적으로 읽어들임
+        case FILE_WORK_HELP:
+            opRet = helpCopyJob();
+            opErrno = errno;
+            endFileJobHelp();
+            errno = opErrno;
+            return opRet;
+        case FILE_WORK_JOB:
             break;  // 계속 진행
-        case -1:  // 읽기 실패
-        default:  // Size 이상 있음
-            return -1;  // abort
     }
 
-    switch (command.type) {
+    command = &job->task;
+    switch (command->type) {
         case COPY:
-            copyFile(&command.src, &command.dst, args->progressInfo);
-            if (command.src.dirFd != command.dst.dirFd)
-                close(command.dst.dirFd);
+            opRet = copyFile(&command->src, &command->dst, args->progressInfo, job);
             break;
         case MOVE:
-            moveFile(&command.src, &command.dst, args->progressInfo);
-            if (command.src.dirFd != command.dst.dirFd)
-                close(command.dst.dirFd);
+            opRet = moveFile(&command->src, &command->dst, args->progressInfo, job);
+            if (opRet == 1)  // 복사로 바뀌어 다시 대기함: 다른 Thread가 이어서 실행
+                return 0;
             break;
         case DELETE:
-            removeFile(&command.src, args->progressInfo);
-            // DELETE: dst.dirFd 유효하지 않음 -> close()하면 안 됨
+            opRet = removeFile(&command->src, args->progressInfo);
             break;
         case MKDIR:
-            makeDirectory(&command.src, args->progressInfo);
-            // MKDIR: dst.dirFd 유효하지 않음 -> close()하면 안 됨
+            opRet = makeDirectory(&command->src, args->progressInfo);
             break;
     }
 
-    close(command.src.dirFd);  // 항상 쓰임 -> 항상 close()
+    opErrno = errno;
+    finishFileJob(job, opRet, opErrno);  // 작업의 fd들: 여기서 close()
+    errno = opErrno;  // 통계에 기록될 오류: 작업의 errno
 
-    return 0;
+    return opRet;
 }
@@ -41,10 +41,34 @@ typedef struct _SrcDstInfo {
     size_t fileSize;
 } SrcDstInfo;
 
+/**
+ * @enum _ReflinkMode
+ * 복사 시 원본과 Extent 공유 (Reflink, CoW 파일 시스템: Btrfs, XFS 등) 여부
+ */
+typedef enum _ReflinkMode {
+    REFLINK_AUTO,  // 가능하면 공유, 불가능하면 데이터 복사
+    REFLINK_ALWAYS,  // 공유만 허용 (불가능: 복사 실패)
+    REFLINK_NEVER,  // 공유 금지 (항상 데이터 복사)
+    REFLINK_MODE_CNT
+} ReflinkMode;
+
+/**
+ * @enum _CacheMode
+ * 복사 시 Page Cache 사용 방식 (Streaming: 대용량 복사가 다른 프로세스가 쓰는 Cache를 밀어내지 않게)
+ */
+typedef enum _CacheMode {
+    CACHE_NORMAL,  // 그대로 사용
+    CACHE_STREAM,  // 원본 atime 갱신 X, 순차 읽기 알림, 복사한 구간: Writeback 후 Cache에서 제거
+    CACHE_DIRECT,  // CACHE_STREAM + O_DIRECT로 읽고 씀 (지원 X: CACHE_STREAM)
+    CACHE_MODE_CNT
+} CacheMode;
+
 typedef struct _FileTask {
     FileOperation type;
     SrcDstInfo src;
     SrcDstInfo dst;
+    ReflinkMode reflink;  // 복사 시 Extent 공유 여부 (COPY, 다른 장치로 MOVE)
+    CacheMode cache;  // 복사 시 Page Cache 사용 방식 (COPY, 다른 장치로 MOVE)
 } FileTask;
 
 typedef struct _FileProgressInfo {
@@ -58,15 +82,13 @@ typedef struct _FileProgressInfo {
  *
  * @var _FileOperatorArgs::commonArgs Thread들 공통 공유 변수
  * @var _FileOperatorArgs::progressInfo 진행 상태 공유 변수
- * @var _FileOperatorArgs::pipeEnd 명령 읽어올, pipe의 read용 끝단
- * @var _FileOperatorArgs::pipeReadMutex 명령 읽기 보호 Mutex
+ *
+ * @details
+ * - 명령: 파일 작업 Queue (job_queue.h)에서 받음
  */
 typedef struct _FileOperatorArgs {
     ThreadArgs commonArgs;  // Thread들 공통 공유 변수
     FileProgressInfo *progressInfo;  // 진행 상태 공유 변수
-    // 명령 관련
-    int pipeEnd;  // 명령 읽어올, pipe의 read용 끝
-    pthread_mutex_t *pipeReadMutex;  // 명령 읽기 보호 Mutex
 } FileOperatorArgs;
 
 
@@ -0,0 +1,428 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "commons.h"
+#include "config.h"
+#include "job_queue.h"
+#include "thread_commons.h"
+
+#define BULK_WORKERS (MAX_FILE_OPERATORS - FILE_JOB_RESERVED_WORKERS)  // 우선순위 HIGH 아닌 일을 동시에 실행하는 최대 Thread 수
+
+
+static FileJob jobs[MAX_FILE_JOBS];  // 작업들 (대기, 실행 중, 끝난 작업 모두)
+static pthread_mutex_t queueMutex = PTHREAD_MUTEX_INITIALIZER;  // 작업들, 아래 변수들 보호
+static pthread_cond_t workAvailable = PTHREAD_COND_INITIALIZER;  // 실행할 작업 or 도움 요청 생김, Queue 닫힘
+static pthread_cond_t jobResumed = PTHREAD_COND_INITIALIZER;  // 일시정지된 작업 재개 or 취소됨
+static unsigned int lastJobId;  // 마지막으로 부여한 작업 번호
+static unsigned int bulkRunning;  // 실행 중인 우선순위 HIGH 아닌 일 수 (도움 포함)
+static unsigned int helpRequests;  // 아직 받지 않은 도움 요청 수
+static bool isQueueClosed;
+
+
+/**
+ * 작업의 fd들 close()
+ *
+ * @param task 작업 내용
+ */
+static void closeTaskFds(FileTask *task);
+
+/**
+ * 폴더 fd + 이름으로 표시용 경로 만들기 (/proc/self/fd 사용)
+ *
+ * @param dirFd 상위 폴더
+ * @param name 이름
+ * @param buf (반환) 경로 (FILE_JOB_PATH_LEN bytes, 넘으면: "..." + 뒷부분)
+ */
+static void resolveTaskPath(int dirFd, const char *name, char *buf);
+
+/**
+ * 작업 번호 순 정렬용 비교 함수 (qsort)
+ *
+ * @param a 작업 상태 1
+ * @param b 작업 상태 2
+ * @return a가 앞: 음수, b가 앞: 양수
+ */
+static int compareJobInfo(const void *a, const void *b);
+
+/**
+ * 번호로 작업 찾기 (queueMutex 잠근 상태에서 호출)
+ *
+ * @param id 작업 번호
+ * @return 작업, 없음: NULL
+ */
+static FileJob *findJob(unsigned int id);
+
+/**
+ * 다음에 실행할 대기 작업 고르기 (queueMutex 잠근 상태에서 호출)
+ *
+ * @param allowBulk 우선순위 HIGH 아닌 작업도 고를지 여부
+ * @return 작업, 없음: NULL
+ */
+static FileJob *pickQueuedJob(bool allowBulk);
+
+
+void closeFileJobQueue(void) {
+    lockMutex(&queueMutex);
+    isQueueClosed = true;
+    for (int i = 0; i < MAX_FILE_JOBS; i++) {
+        if (jobs[i].id == 0)
+            continue;
+        // 일시정지 요청만 되고 아직 확인 지점 전인 실행 중 작업도 포함
+        bool isPausing = jobs[i].state == FILE_JOB_RUNNING && (jobs[i].control & FILE_JOB_CTRL_PAUSE);
+        if (jobs[i].state != FILE_JOB_PAUSED && !isPausing)
+            continue;
+        if (jobs[i].startUSec == 0) {  // 실행 전: 바로 취소
+            jobs[i].state = FILE_JOB_CANCELLED;
+            jobs[i].endUSec = getMonotonicUSec();
+            closeTaskFds(&jobs[i].task);
+        } else {  // 실행 중: 확인 지점에서 깨어나 중단
+            __atomic_or_fetch(&jobs[i].control, FILE_JOB_CTRL_CANCEL, __ATOMIC_RELAXED);
+        }
+    }
+    pthread_cond_broadcast(&jobResumed);
+    pthread_cond_broadcast(&workAvailable);
+    pthread_mutex_unlock(&queueMutex);
+}
+
+unsigned int submitFileJob(const FileTask *task) {
+    FileJob *slot = NULL;
+    FileJobPriority priority;
+    FileTask copiedTask = *task;
+    char srcPath[FILE_JOB_PATH_LEN], dstPath[FILE_JOB_PATH_LEN] = "";
+
+    // 작업 종류로 우선순위 결정
+    switch (task->type) {
+        case MKDIR:
+            priority = FILE_JOB_PRIO_HIGH;
+            break;
+        case MOVE:  // 같은 장치: rename() 1번 -> 바로 끝남
+            priority = task->src.devNo == task->dst.devNo ? FILE_JOB_PRIO_HIGH : FILE_JOB_PRIO_LOW;
+            break;
+        case DELETE:
+            priority = FILE_JOB_PRIO_NORMAL;
+            break;
+        case COPY:
+        default:
+            priority = FILE_JOB_PRIO_LOW;
+            break;
+    }
+
+    // 표시용 경로: Lock 밖에서 미리 확인
+    resolveTaskPath(task->src.dirFd, task->src.name, srcPath);
+    if (task->type == COPY || task->type == MOVE)
+        resolveTaskPath(task->dst.dirFd, task->dst.name, dstPath);
+
+    lockMutex(&queueMutex);
+    if (!isQueueClosed) {
+        // 빈 자리, 없으면 가장 오래 전에 끝난 작업 자리 재사용
+        for (int i = 0; i < MAX_FILE_JOBS; i++) {
+            if (jobs[i].id == 0) {
+                slot = &jobs[i];
+                break;
+            }
+            if (
+                (jobs[i].state == FILE_JOB_DONE || jobs[i].state == FILE_JOB_CANCELLED)
+                && (slot == NULL || jobs[i].endUSec < slot->endUSec)
+            )
+                slot = &jobs[i];
+        }
+    }
+    if (slot == NULL) {  // 가득 참 (모두 대기 or 실행 중), 닫힘
+        pthread_mutex_unlock(&queueMutex);
+        closeTaskFds(&copiedTask);
+        return 0;
+    }
+
+    *slot = (FileJob){
+        .id = ++lastJobId,
+        .task = copiedTask,
+        .state = FILE_JOB_QUEUED,
+        .priority = priority,
+        .submitUSec = getMonotonicUSec()
+    };
+    memcpy(slot->srcPath, srcPath, sizeof(srcPath));
+    memcpy(slot->dstPath, dstPath, sizeof(dstPath));
+    unsigned int id = slot->id;
+    pthread_cond_signal(&workAvailable);
+    pthread_mutex_unlock(&queueMutex);
+    return id;
+}
+
+FileWork takeFileJob(FileProgressInfo *progress, FileJob **job) {
+    lockMutex(&queueMutex);
+    while (1) {
+        bool allowBulk = bulkRunning < BULK_WORKERS;
+        FileJob *picked = pickQueuedJob(false);  // 우선순위 HIGH: 전용 Thread 있음 -> 항상 실행
+        if (picked == NULL && allowBulk && helpRequests > 0) {  // 진행 중인 폴더 복사 먼저 마무리
+            helpRequests--;
+            for (int i = 0; i < MAX_FILE_JOBS; i++) {  // 요청한 작업 중 1개의 요청 수도 줄임 (작업 없는 요청: 전체 수만)
+                if (jobs[i].id != 0 && jobs[i].helpRequests > 0) {
+                    jobs[i].helpRequests--;
+                    break;
+                }
+            }
+            bulkRunning++;
+            pthread_mutex_unlock(&queueMutex);
+            return FILE_WORK_HELP;
+        }
+        if (picked == NULL && allowBulk)
+            picked = pickQueuedJob(true);
+
+        if (picked != NULL) {
+            picked->state = FILE_JOB_RUNNING;
+            picked->isBulkSlot = picked->priority != FILE_JOB_PRIO_HIGH;
+            picked->startUSec = getMonotonicUSec();
+            picked->progress = progress;
+            if (picked->isBulkSlot)
+                bulkRunning++;
+            pthread_mutex_unlock(&queueMutex);
+            *job = picked;
+            return FILE_WORK_JOB;
+        }
+        if (isQueueClosed && pickQueuedJob(true) == NULL) {  // 남은 작업 없음: 종료
+            pthread_mutex_unlock(&queueMutex);
+            return FILE_WORK_STOP;
+        }
+        pthread_cond_wait(&workAvailable, &queueMutex);
+    }
+}
+
+void finishFileJob(FileJob *job, int result, int error) {
+    lockMutex(&queueMutex);
+    job->result = result;
+    job->error = result == -1 ? error : 0;
+    bool isCancelled = result == -1 && (job->control & FILE_JOB_CTRL_CANCEL);  // 폴더 복사: 취소 후 남은 항목 실패로 끝남
+    job->state = isCancelled ? FILE_JOB_CANCELLED : FILE_JOB_DONE;
+    job->endUSec = getMonotonicUSec();
+    job->progress = NULL;
+    helpRequests -= job->helpRequests;  // 받지 않은 도움 요청: 도울 복사 없음 -> 취소
+    job->helpRequests = 0;
+    if (job->isBulkSlot) {
+        bulkRunning--;
+        pthread_cond_broadcast(&workAvailable);  // 자리 남: 기다리던 작업 실행 가능
+    }
+    closeTaskFds(&job->task);
+    pthread_mutex_unlock(&queueMutex);
+}
+
+int requeueFileJob(FileJob *job) {
+    if (job == NULL)
+        return -1;
+    lockMutex(&queueMutex);
+    if (job->isBulkSlot || job->priority != FILE_JOB_PRIO_HIGH || (job->control & FILE_JOB_CTRL_CANCEL)) {
+        pthread_mutex_unlock(&queueMutex);
+        return -1;
+    }
+    job->priority = FILE_JOB_PRIO_LOW;
+    job->startUSec = 0;  // 실행 전으로 취급 (일시정지, 취소, Queue 닫힘 처리)
+    job->progress = NULL;
+    if (job->control & FILE_JOB_CTRL_PAUSE) {  // 실행 중 일시정지 요청: 실행 전 일시정지로 바꿈
+        __atomic_and_fetch(&job->control, ~FILE_JOB_CTRL_PAUSE, __ATOMIC_RELAXED);
+        job->state = FILE_JOB_PAUSED;
+    } else {
+        job->state = FILE_JOB_QUEUED;
+        pthread_cond_broadcast(&workAvailable);
+    }
+    pthread_mutex_unlock(&queueMutex);
+    return 0;
+}
+
+int checkFileJob(FileJob *job) {
+    if (job == NULL)
+        return 0;
+    uint32_t control = __atomic_load_n(&job->control, __ATOMIC_RELAXED);
+    if (__builtin_expect(control == 0, 1))  // 대부분: 요청 없음 -> Lock 없이 계속
+        return 0;
+
+    lockMutex(&queueMutex);
+    while (job->control == FILE_JOB_CTRL_PAUSE && !isQueueClosed) {  // 일시정지: 재개, 취소, Queue 닫힘까지 대기
+        job->state = FILE_JOB_PAUSED;
+        pthread_cond_wait(&jobResumed, &queueMutex);
+    }
+    if (job->state == FILE_JOB_PAUSED)
+        job->state = FILE_JOB_RUNNING;
+    bool isCancelled = (job->control & FILE_JOB_CTRL_CANCEL) || (isQueueClosed && (job->control & FILE_JOB_CTRL_PAUSE));
+    pthread_mutex_unlock(&queueMutex);
+
+    if (isCancelled) {
+        errno = ECANCELED;
+        return -1;
+    }
+    return 0;
+}
+
+void requestFileJobHelp(FileJob *job, unsigned int cnt) {
+    lockMutex(&queueMutex);
+    helpRequests += cnt;
+    if (job != NULL)
+        job->helpRequests += cnt;
+    pthread_cond_broadcast(&workAvailable);
+    pthread_mutex_unlock(&queueMutex);
+}
+
+void endFileJobHelp(void) {
+    lockMutex(&queueMutex);
+    bulkRunning--;
+    pthread_cond_broadcast(&workAvailable);
+    pthread_mutex_unlock(&queueMutex);
+}
+
+int cancelFileJob(unsigned int id) {
+    int ret = -1;
+    lockMutex(&queueMutex);
+    FileJob *job = findJob(id);
+    if (job != NULL && job->state != FILE_JOB_DONE && job->state != FILE_JOB_CANCELLED) {
+        if (job->startUSec == 0) {  // 실행 전: 바로 취소
+            job->state = FILE_JOB_CANCELLED;
+            job->endUSec = getMonotonicUSec();
+            closeTaskFds(&job->task);
+        } else {  // 실행 중: 다음 확인 지점에서 중단 (일시정지 중이면 깨움)
+            __atomic_or_fetch(&job->control, FILE_JOB_CTRL_CANCEL, __ATOMIC_RELAXED);
+            pthread_cond_broadcast(&jobResumed);
+        }
+        ret = 0;
+    }
+    pthread_mutex_unlock(&queueMutex);
+    return ret;
+}
+
+int pauseFileJob(unsigned int id) {
+    int ret = -1;
+    lockMutex(&queueMutex);
+    FileJob *job = findJob(id);
+    if (job != NULL && (job->state == FILE_JOB_QUEUED || job->state == FILE_JOB_RUNNING)) {
+        if (job->state == FILE_JOB_QUEUED)  // 실행 전: 고르지 않음
+            job->state = FILE_JOB_PAUSED;
+        else {  // 실행 중: 다음 확인 지점에서 대기 (상태: 그때 바뀜)
+            __atomic_or_fetch(&job->control, FILE_JOB_CTRL_PAUSE, __ATOMIC_RELAXED);
+            job->pauseStartUSec = getMonotonicUSec();
+        }
+        ret = 0;
+    }
+    pthread_mutex_unlock(&queueMutex);
+    return ret;
+}
+
+int resumeFileJob(unsigned int id) {
+    int ret = -1;
+    lockMutex(&queueMutex);
+    FileJob *job = findJob(id);
+    if (job != NULL && (job->state == FILE_JOB_PAUSED || (job->control & FILE_JOB_CTRL_PAUSE))) {
+        if (job->startUSec == 0) {  // 실행 전: 다시 대기
+            job->state = FILE_JOB_QUEUED;
+            pthread_cond_signal(&workAvailable);
+        } else {
+            __atomic_and_fetch(&job->control, ~FILE_JOB_CTRL_PAUSE, __ATOMIC_RELAXED);
+            job->pausedUSec += getMonotonicUSec() - job->pauseStartUSec;  // 전송 속도 계산 시 제외
+            pthread_cond_broadcast(&jobResumed);
+        }
+        ret = 0;
+    }
+    pthread_mutex_unlock(&queueMutex);
+    return ret;
+}
+
+int setFileJobPriority(unsigned int id, FileJobPriority priority) {
+    int ret = -1;
+    lockMutex(&queueMutex);
+    FileJob *job = findJob(id);
+    if (job != NULL && job->state != FILE_JOB_DONE && job->state != FILE_JOB_CANCELLED) {
+        job->priority = priority;  // 실행 중: 사용 중인 Thread 자리는 그대로
+        pthread_cond_signal(&workAvailable);
+        ret = 0;
+    }
+    pthread_mutex_unlock(&queueMutex);
+    return ret;
+}
+
+size_t getFileJobs(FileJobInfo *infos, size_t maxCnt) {
+    size_t cnt = 0;
+
+    lockMutex(&queueMutex);
+    for (int i = 0; i < MAX_FILE_JOBS && cnt < maxCnt; i++) {
+        if (jobs[i].id == 0)
+            continue;
+        FileJobInfo *info = &infos[cnt++];
+        info->id = jobs[i].id;
+        info->type = jobs[i].task.type;
+        info->state = jobs[i].state;
+        info->priority = jobs[i].priority;
+        info->isPausing = jobs[i].state == FILE_JOB_RUNNING && (jobs[i].control & FILE_JOB_CTRL_PAUSE);
+        info->result = jobs[i].result;
+        info->error = jobs[i].error;
+        info->doneBytes = __atomic_load_n(&jobs[i].doneBytes, __ATOMIC_RELAXED);
+        info->totalBytes = __atomic_load_n(&jobs[i].totalBytes, __ATOMIC_RELAXED);
+        info->startUSec = jobs[i].startUSec;
+        info->endUSec = jobs[i].endUSec;
+        info->pausedUSec = jobs[i].pausedUSec;
+        memcpy(info->srcPath, jobs[i].srcPath, sizeof(info->srcPath));
+        memcpy(info->dstPath, jobs[i].dstPath, sizeof(info->dstPath));
+    }
+    pthread_mutex_unlock(&queueMutex);
+
+    qsort(infos, cnt, sizeof(FileJobInfo), compareJobInfo);  // 자리 재사용 -> 배열 순서 != 추가된 순서
+    return cnt;
+}
+
+void closeTaskFds(FileTask *task) {
+    // COPY, MOVE만 dst.dirFd 사용 (DELETE, MKDIR: 유효하지 않음 -> close()하면 안 됨)
+    if ((task->type == COPY || task->type == MOVE) && task->src.dirFd != task->dst.dirFd)
+        close(task->dst.dirFd);
+    close(task->src.dirFd);  // 항상 쓰임 -> 항상 close()
+}
+
+FileJob *findJob(unsigned int id) {
+    if (id == 0)
+        return NULL;
+    for (int i = 0; i < MAX_FILE_JOBS; i++)
+        if (jobs[i].id == id)
+            return &jobs[i];
+    return NULL;
+}
+
+FileJob *pickQueuedJob(bool allowBulk) {
+    FileJob *picked = NULL;
+    for (int i = 0; i < MAX_FILE_JOBS; i++) {
+        if (jobs[i].id == 0 || jobs[i].state != FILE_JOB_QUEUED)
+            continue;
+        if (!allowBulk && jobs[i].priority != FILE_JOB_PRIO_HIGH)
+            continue;
+        if (
+            picked == NULL || jobs[i].priority < picked->priority
+            || (jobs[i].priority == picked->priority && jobs[i].id < picked->id)
+        )
+            picked = &jobs[i];
+    }
+    return picked;
+}
+
+void resolveTaskPath(int dirFd, const char *name, char *buf) {
+    char linkPath[32];
+    char dirPath[PATH_MAX];
+    char fullPath[PATH_MAX + NAME_MAX + 2];
+
+    snprintf(linkPath, sizeof(linkPath), "/proc/self/fd/%d", dirFd);
+    ssize_t dirLen = readlink(linkPath, dirPath, sizeof(dirPath) - 1);
+    if (dirLen <= 0) {  // 확인 불가: 이름만 표시
+        snprintf(buf, FILE_JOB_PATH_LEN, "%s", name);
+        return;
+    }
+    dirPath[dirLen] = '\0';
+
+    int fullLen = snprintf(fullPath, sizeof(fullPath), "%s%s%s", dirPath, dirPath[dirLen - 1] == '/' ? "" : "/", name);
+    if (fullLen < FILE_JOB_PATH_LEN)
+        memcpy(buf, fullPath, fullLen + 1);
+    else  // 너무 김: 이름 쪽이 보이게 앞부분 자름
+        snprintf(buf, FILE_JOB_PATH_LEN, "...%s", fullPath + fullLen - (FILE_JOB_PATH_LEN - 4));
+}
+
+int compareJobInfo(const void *a, const void *b) {
+    unsigned int idA = ((const FileJobInfo *)a)->id, idB = ((const FileJobInfo *)b)->id;
+    return (idA > idB) - (idA < idB);
+}
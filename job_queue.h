@@ -0,0 +1,245 @@
+#ifndef _JOB_QUEUE_H_INCLUDED_
+#define _JOB_QUEUE_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "file_operator.h"
+
+
+#define FILE_JOB_CTRL_PAUSE (1 << 0)  // 일시정지 요청
+#define FILE_JOB_CTRL_CANCEL (1 << 1)  // 취소 요청
+
+
+/**
+ * @enum _FileJobState
+ * 파일 작업 상태
+ */
+typedef enum _FileJobState {
+    FILE_JOB_QUEUED,  // 실행 대기
+    FILE_JOB_RUNNING,  // 실행 중
+    FILE_JOB_PAUSED,  // 일시정지 (실행 전 or 실행 중)
+    FILE_JOB_CANCELLED,  // 취소됨
+    FILE_JOB_DONE  // 끝남 (성공 or 실패: result)
+} FileJobState;
+
+/**
+ * @enum _FileJobPriority
+ * 파일 작업 우선순위 (작을수록 먼저 실행)
+ */
+typedef enum _FileJobPriority {
+    FILE_JOB_PRIO_HIGH,  // 바로 끝나는 작업 (이름 변경, 폴더 생성, 같은 장치 내 이동): 전용 Thread 있음
+    FILE_JOB_PRIO_NORMAL,  // 삭제
+    FILE_JOB_PRIO_LOW,  // 대량 작업 (복사, 다른 장치로 이동)
+    FILE_JOB_PRIO_CNT
+} FileJobPriority;
+
+/**
+ * @enum _FileWork
+ * File Operator Thread가 받은 일 종류
+ */
+typedef enum _FileWork {
+    FILE_WORK_JOB,  // 파일 작업 실행
+    FILE_WORK_HELP,  // 다른 Thread의 폴더 복사 도움 (끝나면 endFileJobHelp() 호출)
+    FILE_WORK_STOP  // Queue 닫힘, 남은 작업 없음: Thread 종료
+} FileWork;
+
+/**
+ * @struct _FileJob
+ * 파일 작업 1개 (Queue 안에 저장: 끝난 후에도 다른 작업이 자리 재사용할 때까지 유지)
+ *
+ * @var _FileJob::id 작업 번호 (1부터 증가, 0: 빈 자리)
+ * @var _FileJob::task 작업 내용 (fd들: 작업 끝나거나 취소될 때 Queue가 close())
+ * @var _FileJob::state 상태 (Queue Mutex로 보호)
+ * @var _FileJob::priority 우선순위 (Queue Mutex로 보호)
+ * @var _FileJob::control 일시정지, 취소 요청 (FILE_JOB_CTRL_*, Atomic 접근)
+ * @var _FileJob::isBulkSlot 실행 시 일반 Thread 자리 사용 (우선순위 HIGH 아님)
+ * @var _FileJob::result 작업 결과 (0: 성공, -1: 실패)
+ * @var _FileJob::error 실패 시 errno
+ * @var _FileJob::submitUSec 추가된 시간
+ * @var _FileJob::startUSec 실행 시작 시간 (0: 아직 실행 전)
+ * @var _FileJob::endUSec 끝난 시간
+ * @var _FileJob::pauseStartUSec 실행 중 마지막으로 일시정지 요청한 시간
+ * @var _FileJob::pausedUSec 실행 중 일시정지된 시간 합 (재개 시 더함)
+ * @var _FileJob::progress 실행 중인 Thread의 진행 상태 (NULL: 실행 전)
+ * @var _FileJob::doneBytes 복사한 크기 합 (Atomic 접근)
+ * @var _FileJob::totalBytes 복사할 크기 합 (폴더: 지금까지 찾은 파일 크기 합, Atomic 접근)
+ * @var _FileJob::helpRequests 이 작업의 폴더 복사 중 아직 받지 않은 도움 요청 수 (Queue Mutex로 보호, 끝나면 취소)
+ * @var _FileJob::srcPath 원본 경로 (추가 시 확인, 표시용)
+ * @var _FileJob::dstPath 대상 경로 (COPY, MOVE만, 표시용)
+ */
+typedef struct _FileJob {
+    unsigned int id;  // 작업 번호
+    FileTask task;  // 작업 내용
+    FileJobState state;  // 상태
+    FileJobPriority priority;  // 우선순위
+    uint32_t control;  // 일시정지, 취소 요청
+    bool isBulkSlot;  // 실행 시 일반 Thread 자리 사용
+    int result;  // 작업 결과
+    int error;  // 실패 시 errno
+    uint64_t submitUSec;  // 추가된 시간
+    uint64_t startUSec;  // 실행 시작 시간
+    uint64_t endUSec;  // 끝난 시간
+    uint64_t pauseStartUSec;  // 실행 중 마지막으로 일시정지 요청한 시간
+    uint64_t pausedUSec;  // 실행 중 일시정지된 시간 합
+    FileProgressInfo *progress;  // 실행 중인 Thread의 진행 상태
+    uint64_t doneBytes;  // 복사한 크기 합
+    uint64_t totalBytes;  // 복사할 크기 합
+    unsigned int helpRequests;  // 아직 받지 않은 도움 요청 수
+    char srcPath[FILE_JOB_PATH_LEN];  // 원본 경로
+    char dstPath[FILE_JOB_PATH_LEN];  // 대상 경로
+} FileJob;
+
+/**
+ * @struct _FileJobInfo
+ * 작업 창에 표시할 작업 1개의 상태 (getFileJobs()로 복사해 옴)
+ *
+ * @var _FileJobInfo::id 작업 번호
+ * @var _FileJobInfo::type 작업 종류
+ * @var _FileJobInfo::state 상태
+ * @var _FileJobInfo::priority 우선순위
+ * @var _FileJobInfo::isPausing 일시정지 요청됨 (실행 중: 다음 확인 지점에서 멈춤)
+ * @var _FileJobInfo::result 작업 결과 (끝난 작업만)
+ * @var _FileJobInfo::error 실패 시 errno
+ * @var _FileJobInfo::doneBytes 복사한 크기 합
+ * @var _FileJobInfo::totalBytes 복사할 크기 합
+ * @var _FileJobInfo::startUSec 실행 시작 시간 (0: 아직 실행 전)
+ * @var _FileJobInfo::endUSec 끝난 시간
+ * @var _FileJobInfo::pausedUSec 실행 중 일시정지된 시간 합
+ * @var _FileJobInfo::srcPath 원본 경로
+ * @var _FileJobInfo::dstPath 대상 경로 (없음: 빈 문자열)
+ */
+typedef struct _FileJobInfo {
+    unsigned int id;  // 작업 번호
+    FileOperation type;  // 작업 종류
+    FileJobState state;  // 상태
+    FileJobPriority priority;  // 우선순위
+    bool isPausing;  // 일시정지 요청됨
+    int result;  // 작업 결과
+    int error;  // 실패 시 errno
+    uint64_t doneBytes;  // 복사한 크기 합
+    uint64_t totalBytes;  // 복사할 크기 합
+    uint64_t startUSec;  // 실행 시작 시간
+    uint64_t endUSec;  // 끝난 시간
+    uint64_t pausedUSec;  // 실행 중 일시정지된 시간 합
+    char srcPath[FILE_JOB_PATH_LEN];  // 원본 경로
+    char dstPath[FILE_JOB_PATH_LEN];  // 대상 경로
+} FileJobInfo;
+
+
+/**
+ * 파일 작업 Queue 닫음: 남은 작업 끝나면 File Operator Thread들 종료
+ *
+ * @details
+ * - 대기 중인 작업: 그대로 실행, 일시정지된 작업: 취소
+ */
+void closeFileJobQueue(void);
+
+/**
+ * 파일 작업 추가 (작업 종류에 따라 우선순위 결정)
+ *
+ * @param task 작업 내용 (fd들: Queue가 넘겨받음, 실패 시에도 close())
+ * @return 작업 번호, 실패 (Queue 가득 참, 닫힘): 0
+ */
+unsigned int submitFileJob(const FileTask *task);
+
+/**
+ * 실행할 일 받기 (없으면 대기)
+ *
+ * @param progress 받는 Thread의 진행 상태 (작업에 연결됨)
+ * @param job (반환) FILE_WORK_JOB: 실행할 작업
+ * @return 받은 일 종류
+ *
+ * @details
+ * - 우선순위 HIGH 작업 > 폴더 복사 도움 > 나머지 작업 순 (같은 우선순위: 먼저 추가된 작업부터)
+ * - 우선순위 HIGH가 아닌 일 (도움 포함): 동시에 `MAX_FILE_OPERATORS - FILE_JOB_RESERVED_WORKERS`개까지만 실행
+ */
+FileWork takeFileJob(FileProgressInfo *progress, FileJob **job);
+
+/**
+ * 작업 끝남 기록 (작업의 fd들 close())
+ *
+ * @param job 끝난 작업
+ * @param result 작업 결과 (0: 성공, -1: 실패)
+ * @param error 실패 시 errno (취소 요청 후 실패: 취소됨으로 기록)
+ */
+void finishFileJob(FileJob *job, int result, int error);
+
+/**
+ * 우선순위 HIGH로 실행 중인 작업을 LOW로 낮춰 다시 대기시킴 (오래 걸리는 작업으로 바뀜: 전용 Thread 비움)
+ *
+ * @param job 실행 중인 작업 (NULL: 무시)
+ * @return 다시 대기시킴: 0 (호출한 Thread: 작업 중단, finishFileJob() 호출 X), 일반 자리에서 실행 중 or 취소 요청됨: -1
+ *
+ * @details
+ * - 예: 같은 장치 내 이동의 rename() 실패 (Bind Mount 사이 등) -> 복사 + 삭제로 바뀜
+ * - 실행 중 일시정지 요청됨: 일시정지된 대기 작업으로 되돌림
+ */
+int requeueFileJob(FileJob *job);
+
+/**
+ * 실행 중인 작업의 확인 지점: 일시정지 요청이면 재개/취소될 때까지 대기 (복사 Chunk 사이마다 호출)
+ *
+ * @param job 실행 중인 작업 (NULL: 항상 계속)
+ * @return 계속: 0, 취소됨: -1 (errno: ECANCELED)
+ */
+int checkFileJob(FileJob *job);
+
+/**
+ * 폴더 복사 도움 요청 (쉬고 있는 File Operator Thread가 FILE_WORK_HELP 받음)
+ *
+ * @param job 폴더 복사 중인 작업 (작업 끝날 때 받지 않은 요청 취소, NULL: 취소 X)
+ * @param cnt 필요한 Thread 수
+ */
+void requestFileJobHelp(FileJob *job, unsigned int cnt);
+
+/**
+ * 폴더 복사 도움 끝남 기록 (FILE_WORK_HELP 받은 Thread가 호출)
+ */
+void endFileJobHelp(void);
+
+/**
+ * 작업 취소 (대기 중: 바로 취소, 실행 중: 다음 확인 지점에서 중단)
+ *
+ * @param id 작업 번호
+ * @return 성공: 0, 없거나 이미 끝남: -1
+ */
+int cancelFileJob(unsigned int id);
+
+/**
+ * 작업 일시정지 (대기 중: 실행 안 함, 실행 중: 다음 확인 지점에서 대기)
+ *
+ * @param id 작업 번호
+ * @return 성공: 0, 없거나 이미 끝남: -1
+ */
+int pauseFileJob(unsigned int id);
+
+/**
+ * 일시정지된 작업 재개
+ *
+ * @param id 작업 번호
+ * @return 성공: 0, 없거나 일시정지 상태 아님: -1
+ */
+int resumeFileJob(unsigned int id);
+
+/**
+ * 작업 우선순위 변경 (대기 중인 작업의 실행 순서에 반영)
+ *
+ * @param id 작업 번호
+ * @param priority 새 우선순위
+ * @return 성공: 0, 없거나 이미 끝남: -1
+ */
+int setFileJobPriority(unsigned int id, FileJobPriority priority);
+
+/**
+ * Queue에 있는 작업들 (대기, 실행 중, 끝난 작업)의 현재 상태 복사
+ *
+ * @param infos (반환) 작업 상태들 (작업 번호 순)
+ * @param maxCnt infos 크기
+ * @return 복사한 작업 수
+ */
+size_t getFileJobs(FileJobInfo *infos, size_t maxCnt);
+
+#endif
@@ -0,0 +1,364 @@
+#include <curses.h>
+#include <panel.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "colors.h"
+#include "commons.h"
+#include "config.h"
+#include "cursor_event.h"
+#include "job_queue.h"
+#include "job_window.h"
+
+#define JOB_ROW_LEN 512  // 표 1줄의 최대 길이 (경로 2개 포함)
+#define JOB_FIXED_COLS_W 67  // 경로 앞의 열들 폭 (JOB_HEADER 참조)
+#define JOB_COMPACT_W 80  // 창 폭이 이보다 좁으면: 경로, 우선순위, 종류 열 생략
+
+#define JOB_HEADER "  ID STATE    PRIO OP          DONE / TOTAL           RATE    ETA  SOURCE -> DESTINATION"
+#define JOB_COMPACT_HEADER "  ID STATE         DONE       RATE    ETA"
+#define JOB_KEYS_HINT " [x] Cancel  [Space] Pause/Resume  [+/-] Priority  [j] Close "
+
+
+/**
+ * @struct _JobRate
+ * 작업 1개의 전송 속도 계산용 Sample
+ *
+ * @var _JobRate::id 작업 번호 (0: 빈 자리)
+ * @var _JobRate::sampleBytes 마지막 Sample의 복사한 크기
+ * @var _JobRate::sampleUSec 마지막 Sample 시간
+ * @var _JobRate::bytesPerSec 현재 전송 속도 (0: 아직 모름)
+ */
+typedef struct _JobRate {
+    unsigned int id;  // 작업 번호
+    uint64_t sampleBytes;  // 마지막 Sample의 복사한 크기
+    uint64_t sampleUSec;  // 마지막 Sample 시간
+    uint64_t bytesPerSec;  // 현재 전송 속도
+} JobRate;
+
+
+static WINDOW *window;
+static PANEL *panel;
+
+static FileJobInfo infos[MAX_FILE_JOBS];  // 마지막으로 읽은 작업 목록 (작업 번호 순)
+static size_t infoCnt;
+static JobRate rates[MAX_FILE_JOBS];  // 작업별 전송 속도
+
+static CursorEventQueue cursorEvents;  // 커서 이동 이벤트 저장
+static size_t currentPos;  // 선택된 줄 ( [0, infoCnt) )
+static unsigned int selectedId;  // 선택된 작업 번호 (목록 다시 읽어도 같은 작업 선택 유지)
+static size_t topPos;  // 창 맨 위에 표시된 줄
+
+
+/**
+ * 파일 작업 창 크기 업데이트 (화면 크기 바뀐 경우만 재배치)
+ *
+ * @param winH (반환) 창의 높이
+ * @param winW (반환) 창의 너비
+ */
+static void setJobWinSize(int *winH, int *winW);
+
+/**
+ * 작업 목록 다시 읽고, 쌓인 커서 이동 적용
+ */
+static void loadJobs(void);
+
+/**
+ * 실행 중인 작업의 전송 속도 갱신 (`JOB_RATE_SAMPLE_USEC`마다)
+ *
+ * @param info 작업 상태
+ * @param now 현재 시간
+ * @return 전송 속도 [단위: bytes/s] (0: 모름)
+ */
+static uint64_t updateJobRate(const FileJobInfo *info, uint64_t now);
+
+/**
+ * 작업 1개를 표 1줄로 변환
+ *
+ * @param info 작업 상태
+ * @param now 현재 시간
+ * @param pathW 경로 열 폭 (0: 간단히 표시)
+ * @param buf (반환) 표 1줄 (최소 JOB_ROW_LEN bytes)
+ */
+static void formatJobRow(const FileJobInfo *info, uint64_t now, int pathW, char *buf);
+
+/**
+ * 남은 시간을 짧은 문자열로 변환 (예: "45s", "3m05s", "1h02m")
+ *
+ * @param sec 남은 시간 [단위: 초]
+ * @param buf (반환) 변환된 문자열 (최소 16 bytes)
+ */
+static void formatEta(uint64_t sec, char *buf);
+
+/**
+ * 경로를 폭에 맞게 자름 (넘으면: 이름 쪽이 보이게 "..." + 뒷부분)
+ *
+ * @param path 경로
+ * @param width 최대 폭
+ * @return 출력할 시작 위치 (자르지 않음: path 그대로)
+ */
+static const char *fitPath(const char *path, int width);
+
+
+int initJobWindow(void) {
+    int screenW, screenH;
+    getmaxyx(stdscr, screenH, screenW);
+
+    window = newwin(screenH - 5, screenW, 2, 0);
+    if (window == NULL) {
+        return -1;
+    }
+    panel = new_panel(window);
+    if (panel == NULL) {
+        delwin(window);
+        window = NULL;
+        return -1;
+    }
+    hide_panel(panel);
+    return 0;
+}
+
+void hideJobWindow(void) {
+    hide_panel(panel);
+}
+
+void delJobWindow(void) {
+    if (window == NULL)
+        return;
+    del_panel(panel);
+    delwin(window);
+}
+
+void setJobWinSize(int *winH, int *winW) {
+    static int prevScreenH = 0, prevScreenW = 0;
+    int screenH, screenW;
+    getmaxyx(stdscr, screenH, screenW);
+
+    if (prevScreenH != screenH || prevScreenW != screenW) {
+        prevScreenH = screenH;
+        prevScreenW = screenW;
+
+        // 윈도우, 패널 레이아웃 재배치 (프로세스 창과 같은 위치)
+        wresize(window, screenH - 5, screenW);
+        replace_panel(panel, window);
+        move_panel(panel, 2, 0);
+    }
+    getmaxyx(window, *winH, *winW);
+}
+
+void updateJobWindow(void) {
+    int winH, winW;
+    char row[JOB_ROW_LEN];
+
+    setJobWinSize(&winH, &winW);
+    loadJobs();
+
+    int availableH = winH - 3;  // 상하단 테두리, 헤더 제외
+    if (availableH < 1)
+        availableH = 1;
+    // 선택된 줄이 보이게 스크롤
+    if (currentPos < topPos)
+        topPos = currentPos;
+    else if (currentPos >= topPos + availableH)
+        topPos = currentPos - availableH + 1;
+    if (topPos + availableH > infoCnt)
+        topPos = infoCnt > availableH ? infoCnt - availableH : 0;
+
+    int pathW = winW >= JOB_COMPACT_W ? winW - 2 - JOB_FIXED_COLS_W : 0;
+    uint64_t now = getMonotonicUSec();
+
+    werase(window);
+    if (isColorSafe)
+        wbkgd(window, COLOR_PAIR(PRCSBGRND));
+    box(window, 0, 0);
+    mvwaddnstr(window, 0, 2, " File jobs ", winW - 4);
+    mvwaddnstr(window, winH - 1, 2, JOB_KEYS_HINT, winW - 4);
+    mvwaddnstr(window, 1, 1, pathW > 0 ? JOB_HEADER : JOB_COMPACT_HEADER, winW - 2);
+
+    applyColor(window, PRCSFILE);
+    if (infoCnt == 0)
+        mvwaddnstr(window, 2, 1, "  (no file jobs)", winW - 2);
+    for (size_t i = topPos; i < infoCnt && i < topPos + availableH; i++) {
+        formatJobRow(&infos[i], now, pathW, row);
+        if (i == currentPos)
+            wattron(window, A_REVERSE);
+        mvwaddnstr(window, i - topPos + 2, 1, row, winW - 2);
+        whline(window, ' ', winW - 1 - getcurx(window));  // 선택 표시: 줄 끝까지
+        if (i == currentPos)
+            wattroff(window, A_REVERSE);
+    }
+    removeColor(window, PRCSFILE);
+
+    top_panel(panel);
+}
+
+void selectPreviousJob(void) {
+    pushCursorEvent(&cursorEvents, CURSOR_UP, 0);  // <한 칸 위로> Event 저장
+}
+
+void selectNextJob(void) {
+    pushCursorEvent(&cursorEvents, CURSOR_DOWN, 0);  // <한 칸 아래로> Event 저장
+}
+
+int cancelSelectedJob(void) {
+    loadJobs();  // 같은 Frame에 입력된 커서 이동 반영
+    if (infoCnt == 0)
+        return -1;
+    return cancelFileJob(selectedId);
+}
+
+int togglePauseSelectedJob(void) {
+    loadJobs();
+    if (infoCnt == 0)
+        return -1;
+    const FileJobInfo *info = &infos[currentPos];
+    if (info->state == FILE_JOB_PAUSED || info->isPausing)
+        return resumeFileJob(info->id);
+    return pauseFileJob(info->id);
+}
+
+int changeSelectedJobPriority(bool isRaise) {
+    loadJobs();
+    if (infoCnt == 0)
+        return -1;
+    const FileJobInfo *info = &infos[currentPos];
+    if (isRaise && info->priority == FILE_JOB_PRIO_HIGH)
+        return -1;
+    if (!isRaise && info->priority == FILE_JOB_PRIO_CNT - 1)
+        return -1;
+    return setFileJobPriority(info->id, isRaise ? info->priority - 1 : info->priority + 1);
+}
+
+void loadJobs(void) {
+    infoCnt = getFileJobs(infos, MAX_FILE_JOBS);
+
+    // 이전에 선택된 작업 위치 찾기 (끝난 작업 자리 재사용으로 사라졌으면: 같은 줄 유지)
+    for (size_t i = 0; i < infoCnt; i++) {
+        if (infos[i].id == selectedId) {
+            currentPos = i;
+            break;
+        }
+    }
+    CursorMove move = drainCursorEvents(&cursorEvents);
+    currentPos = applyCursorMove(&move, currentPos, infoCnt, window != NULL ? getmaxy(window) - 3 : 1, currentPos);
+    selectedId = infoCnt > 0 ? infos[currentPos].id : 0;
+}
+
+uint64_t updateJobRate(const FileJobInfo *info, uint64_t now) {
+    JobRate *rate = NULL, *oldest = &rates[0];
+    for (int i = 0; i < MAX_FILE_JOBS; i++) {
+        if (rates[i].id == info->id) {
+            rate = &rates[i];
+            break;
+        }
+        if (rates[i].sampleUSec < oldest->sampleUSec)
+            oldest = &rates[i];
+    }
+    if (rate == NULL) {  // 처음 보는 작업: 가장 오래된 자리에 첫 Sample
+        *oldest = (JobRate){ .id = info->id, .sampleBytes = info->doneBytes, .sampleUSec = now };
+        return 0;
+    }
+
+    if (info->state != FILE_JOB_RUNNING || info->isPausing) {  // 멈춤: 재개 후 다시 계산
+        rate->sampleBytes = info->doneBytes;
+        rate->sampleUSec = now;
+        rate->bytesPerSec = 0;
+        return 0;
+    }
+    uint64_t elapsed = now - rate->sampleUSec;
+    if (elapsed >= JOB_RATE_SAMPLE_USEC) {
+        uint64_t current = (info->doneBytes - rate->sampleBytes) * 1000000 / elapsed;
+        rate->bytesPerSec = rate->bytesPerSec == 0 ? current : (rate->bytesPerSec + current) / 2;  // 순간 변동 완화
+        rate->sampleBytes = info->doneBytes;
+        rate->sampleUSec = now;
+    }
+    return rate->bytesPerSec;
+}
+
+void formatJobRow(const FileJobInfo *info, uint64_t now, int pathW, char *buf) {
+    static const char *opNames[] = { "copy", "move", "delete", "mkdir" };
+    static const char *prioNames[] = { "high", "norm", "low" };
+    char done[16] = "-", total[16] = "-", rateStr[24] = "-", eta[16] = "-";
+    const char *state;
+
+    switch (info->state) {
+        case FILE_JOB_QUEUED:
+            state = "queued";
+            break;
+        case FILE_JOB_RUNNING:
+            state = info->isPausing ? "pausing" : "running";
+            break;
+        case FILE_JOB_PAUSED:
+            state = "paused";
+            break;
+        case FILE_JOB_CANCELLED:
+            state = "cancel";
+            break;
+        case FILE_JOB_DONE:
+        default:
+            state = info->result == 0 ? "done" : "failed";
+            break;
+    }
+
+    uint64_t bytesPerSec = updateJobRate(info, now);
+    if (info->doneBytes != 0 || info->totalBytes != 0) {  // 복사한 작업만 (이름 변경, 삭제 등: 크기 없음)
+        formatSizeBuf(info->doneBytes, done, sizeof(done));
+        formatSizeBuf(info->totalBytes > info->doneBytes ? info->totalBytes : info->doneBytes, total, sizeof(total));
+
+        if (info->state == FILE_JOB_DONE && info->endUSec > info->startUSec + info->pausedUSec)  // 끝남: 전체 평균 (일시정지 제외)
+            bytesPerSec = info->doneBytes * 1000000 / (info->endUSec - info->startUSec - info->pausedUSec);
+        if (bytesPerSec > 0) {
+            formatSizeBuf(bytesPerSec, rateStr, sizeof(rateStr) - 2);  // "/s" 자리 남김
+            strcat(rateStr, "/s");
+        }
+        if (info->state == FILE_JOB_RUNNING && bytesPerSec > 0 && info->totalBytes > info->doneBytes)
+            formatEta((info->totalBytes - info->doneBytes) / bytesPerSec, eta);
+    }
+
+    if (pathW <= 0) {
+        snprintf(buf, JOB_ROW_LEN, "%4u %-8s %9s %10s %6s", info->id, state, done, rateStr, eta);
+        return;
+    }
+
+    int len = snprintf(
+        buf, JOB_ROW_LEN, "%4u %-8s %-4s %-6s %9s / %-9s %10s %6s  ",
+        info->id, state, prioNames[info->priority], opNames[info->type], done, total, rateStr, eta
+    );
+    if (len < 0 || len >= JOB_ROW_LEN)
+        return;
+    if (info->dstPath[0] == '\0') {
+        snprintf(buf + len, JOB_ROW_LEN - len, "%s", fitPath(info->srcPath, pathW));
+    } else {
+        int srcW = (pathW - 4) / 2;  // " -> " 제외하고 반씩
+        int dstW = pathW - 4 - srcW;
+        snprintf(buf + len, JOB_ROW_LEN - len, "%s -> %s", fitPath(info->srcPath, srcW), fitPath(info->dstPath, dstW));
+    }
+}
+
+void formatEta(uint64_t sec, char *buf) {
+    if (sec < 60)
+        sprintf(buf, "%us", (unsigned int)sec);
+    else if (sec < 60 * 60)
+        sprintf(buf, "%um%02us", (unsigned int)(sec / 60), (unsigned int)(sec % 60));
+    else if (sec < 100 * 60 * 60)
+        sprintf(buf, "%uh%02um", (unsigned int)(sec / 3600), (unsigned int)(sec / 60 % 60));
+    else
+        sprintf(buf, ">99h");
+}
+
+const char *fitPath(const char *path, int width) {
+    static char fitted[2][FILE_JOB_PATH_LEN];  // 1줄에 경로 2개까지 (원본, 대상)
+    static int nextBuf;
+    int len = strlen(path);
+
+    if (len <= width)
+        return path;
+    if (width < 4)
+        return path + len - (width > 0 ? width : 0);
+    char *buf = fitted[nextBuf];
+    nextBuf = !nextBuf;
+    snprintf(buf, FILE_JOB_PATH_LEN, "...%s", path + len - (width - 3));
+    return buf;
+}
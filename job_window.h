@@ -0,0 +1,66 @@
+#ifndef _JOB_WINDOW_H_INCLUDED_
+#define _JOB_WINDOW_H_INCLUDED_
+
+#include <stdbool.h>
+
+
+/**
+ * 파일 작업 창 초기화 (숨겨진 상태로 생성, 프로세스 창과 같은 위치)
+ *
+ * @return 성공: 0, 실패: -1
+ */
+int initJobWindow(void);
+
+/**
+ * 파일 작업 창 숨김
+ */
+void hideJobWindow(void);
+
+/**
+ * 파일 작업 창 자원 해제
+ */
+void delJobWindow(void);
+
+/**
+ * 작업 목록 다시 읽어 파일 작업 창 갱신 (표시 중일 때 매 Frame 호출)
+ *
+ * @details
+ * - 열: 번호, 상태, 우선순위, 종류, 복사한 크기 / 전체 크기, 전송 속도, 남은 시간, 원본 -> 대상
+ * - 전송 속도: `JOB_RATE_SAMPLE_USEC`마다 복사한 크기 차이로 계산 (이전 값과 평균), 끝난 작업: 전체 평균
+ * - 남은 시간: 폴더 복사는 지금까지 찾은 크기 기준 (펼칠수록 늘어남)
+ */
+void updateJobWindow(void);
+
+/**
+ * 이전 (위) 작업 선택
+ */
+void selectPreviousJob(void);
+
+/**
+ * 다음 (아래) 작업 선택
+ */
+void selectNextJob(void);
+
+/**
+ * 선택된 작업 취소
+ *
+ * @return 성공: 0, 선택된 작업 없음 or 이미 끝남: -1
+ */
+int cancelSelectedJob(void);
+
+/**
+ * 선택된 작업 일시정지/재개 전환
+ *
+ * @return 성공: 0, 선택된 작업 없음 or 이미 끝남: -1
+ */
+int togglePauseSelectedJob(void);
+
+/**
+ * 선택된 작업의 우선순위 변경 (대기 중인 작업의 실행 순서에 반영)
+ *
+ * @param isRaise 올림 여부 (false: 내림)
+ * @return 성공: 0, 선택된 작업 없음, 이미 끝남 or 더 바꿀 수 없음: -1
+ */
+int changeSelectedJobPriority(bool isRaise);
+
+#endif
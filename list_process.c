@@ -11,6 +11,7 @@
 #include "config.h"
 #include "list_process.h"
 #include "thread_commons.h"
+#include "trace.h"
 
 #define PROC_DIR "/proc"
 #define STAT_FILENAME "stat"
@@ -19,6 +20,7 @@
 
 static long pageSize;  // 메모리 Page Size: Thread 시작 전 알아내야 함
 
+static int initProcThread(void *argsPtr);
 static int procThreadMain(void *argsPtr);
 static size_t findInsertPosition(Process **readItems, size_t size, unsigned long rsize);
 
@@ -30,13 +32,19 @@ int startProcessThread(pthread_t *newThread, ProcessThreadArgs *args) {
         return -1;
     // clang-format off
     if (startThread(
-        newThread, NULL, procThreadMain, NULL,
+        newThread, initProcThread, procThreadMain, NULL,
         PROC_SCAN_INTERVAL_USEC, &args->commonArgs, args
     ) == -1)  // clang-format on
         return -1;
     return 0;
 }
 
+// Trace에 표시할 Thread 이름 등록 (Thread 시작 시 1번)
+int initProcThread(void *argsPtr) {
+    traceThreadName("process");
+    return 0;
+}
+
 // 프로세스 정보를 읽는 스레드의 메인 함수
 int procThreadMain(void *argsPtr) {
     static Process elements[MAX_PROCESSES];
@@ -44,10 +52,13 @@ int procThreadMain(void *argsPtr) {
 
     ProcessThreadArgs *args = (ProcessThreadArgs *)argsPtr;
 
+    TRACE_BEGIN(scanStartUSec);
+
     // /proc 디렉토리를 열기
     DIR *dir = opendir(PROC_DIR);
     if (dir == NULL) {
         perror("Failed to open /proc");
+        TRACE_END(scanStartUSec, "scanProcesses");
         return -1;
     }
 
@@ -97,12 +108,14 @@ int procThreadMain(void *argsPtr) {
     closedir(dir);
 
     // 공유 변수에 읽어들인 정보 쓰기
-    pthread_mutex_lock(&args->entriesMutex);  // 상태 보호 Mutex 잠금
+    lockMutex(&args->entriesMutex);  // 상태 보호 Mutex 잠금 (대기 시간: 통계에 기록)
     args->totalReadItems = readCount;
     for (int i = 0; i < readCount; i++)
         args->processEntries[i] = *elemPointers[i];
     pthread_mutex_unlock(&args->entriesMutex);
+    notifyUi(UI_WAKE_DATA);  // 프로세스 창 다시 그려야 함
 
+    TRACE_END(scanStartUSec, "scanProcesses");
     return 0;
 }
 
@@ -10,7 +10,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <poll.h>
 #include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/signalfd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -18,15 +21,22 @@
 #include "colors.h"
 #include "commons.h"
 #include "config.h"
+#include "debug_overlay.h"
 #include "dir_listener.h"
 #include "dir_window.h"
+#include "file_class.h"
 #include "file_operator.h"
+#include "job_queue.h"
+#include "job_window.h"
 #include "list_process.h"
+#include "parallel_sort.h"
 #include "popup_window.h"
 #include "process_window.h"
 #include "selection_window.h"
+#include "stats_window.h"
 #include "thread_commons.h"
 #include "title_bar.h"
+#include "trace.h"
 
 
 #define CTRL_KEY(key) (key & 037)
@@ -36,14 +46,17 @@ typedef enum _ProgramState {
     NORMAL,
     PROCESS_WIN,
     PROCESS_TERM_POPUP,
+    JOB_WIN,
     RENAME_POPUP,
     CHDIR_POPUP,
     MKDIR_POPUP,
+    JUMP_POPUP,
     WARNING_POPUP
 } ProgramState;
 
 
 static const char *UNSUPPORTED_TYPE = "Unsupported type!";
+static const char *FILE_JOB_QUEUE_FULL = "Too many file jobs queued";
 
 
 WINDOW *titleBar, *bottomBox;
@@ -51,8 +64,6 @@ PANEL *titlePanel, *bottomPanel;  // 패널 추가
 
 int directoryOpenArgs;  // fdopendir()에 전달할 directory file descriptor를 open()할 때 쓸 argument: Thread 시작 전 저장되어야 함
 
-static int pipeFileOpCmd;  // File operator thread로 명령 전달 위한 pipe의 write end
-pthread_mutex_t pipeReadMutex;  // 파일 작업 pipe의 read end 보호 mutex
 
 static pthread_t threadListDir[MAX_DIRWINS];
 static pthread_t threadFileOperators[MAX_FILE_OPERATORS];
@@ -66,10 +77,14 @@ static ProcessThreadArgs processThreadArgs;
 static ProgramState state;
 static unsigned int visibleDirWins;  // 표시된 폴더 표시 창 수
 
+static int sigWinchFd = -1;  // SIGWINCH 수신용 signalfd
+static int uiNotifyFd = -1;  // Thread들의 화면 갱신 알림 수신용 eventfd
+
 static void initVariables(void);  // 변수들 초기화
 static void initScreen(void);  // ncurses 관련 초기화 & subwindow들 생성
 static void initThreads(void);  // thread 관련 초기화
 static void mainLoop(void);  // 프로그램 Main Loop
+static uint32_t waitForEvents(struct timespec lastFrameTime, uint64_t *frameIntervalUSec);  // 다음 Frame 그릴 때까지 대기
 static void stopThreads(void);  // 실행 중인 Thread들 정지
 static void cleanup(void);  // atexit()에 전달할 함수: 프로그램 종료 직전, main() 반환 직후에 수행됨
 
@@ -86,41 +101,62 @@ int main(int argc, char **argv) {
     sigfillset(&ctrlCSignal.sa_mask);
     sigaction(SIGINT, &ctrlCSignal, NULL);
 
+    // SIGWINCH: Handler 대신 signalfd로 받아 poll()에서 대기 (initscr() 전에 막아야 ncurses Handler가 호출되지 않음)
+    sigset_t winchMask;
+    sigemptyset(&winchMask);
+    sigaddset(&winchMask, SIGWINCH);
+    sigprocmask(SIG_BLOCK, &winchMask, NULL);
+    sigWinchFd = signalfd(-1, &winchMask, SFD_NONBLOCK | SFD_CLOEXEC);
+
     atexit(cleanup);
 
+    // 구간 추적: 환경 변수 or `--trace 파일` (인자가 우선)
+    const char *tracePath = getenv(TRACE_ENV);
+    for (int i = 1; i + 1 < argc; i++)
+        if (strcmp(argv[i], "--trace") == 0)
+            tracePath = argv[i + 1];
+    initTrace(tracePath);  // Thread 시작 전 호출
+    traceThreadName("main");
+
     initVariables();
     initScreen();
+    uiNotifyFd = initUiNotifier();  // Thread 시작 전 생성
     initThreads();
     mainLoop();
 
     stopThreads();
+    const char *statsPath = getenv(STATS_DUMP_ENV);
+    if (statsPath != NULL)
+        dumpThreadStats(statsPath);  // Thread 통계 저장 (간격 조정용)
+    flushTrace();  // 기록된 구간 저장 (추적 꺼짐: 무시)
 
     // 창 '지움' (자원 해제)
     delProcessWindow();
+    delJobWindow();
     delTitleBar();
     delBottomBox();
+    delDebugOverlay();
+    delStatsWindow();
 
     return 0;
 }
 
 void initVariables(void) {
     // 변수들 기본값으로 초기화
-    pthread_mutex_init(&pipeReadMutex, NULL);
     for (int i = 0; i < MAX_DIRWINS; i++) {
-        pthread_cond_init(&dirListenerArgs[i].commonArgs.resumeThread, NULL);
-        pthread_mutex_init(&dirListenerArgs[i].commonArgs.statusMutex, NULL);
+        initThreadArgs(&dirListenerArgs[i].commonArgs);
         pthread_mutex_init(&dirListenerArgs[i].bufMutex, NULL);
         pthread_mutex_init(&dirListenerArgs[i].dirMutex, NULL);
+        dirListenerArgs[i].dirFd = -1;  // 첫 목록과 함께 게시됨
+        dirListenerArgs[i].newCwdBaseFd = -1;
+        dirListenerArgs[i].sortKeys = DIRLISTENER_SORTKEY_NAME;  // 기본 정렬: 이름 오름차순
     }
     for (int i = 0; i < MAX_FILE_OPERATORS; i++) {
-        pthread_cond_init(&fileOpArgs[i].commonArgs.resumeThread, NULL);
-        pthread_mutex_init(&fileOpArgs[i].commonArgs.statusMutex, NULL);
+        initThreadArgs(&fileOpArgs[i].commonArgs);
         pthread_mutex_init(&fileProgresses[i].flagMutex, NULL);
-        fileOpArgs[i].pipeReadMutex = &pipeReadMutex;  // 한 pipe의 read end를 여러 개의 Thread가 공유 -> 한 번에 한 곳에서만 읽어야 함
         fileOpArgs[i].progressInfo = &fileProgresses[i];
     }
-    pthread_cond_init(&processThreadArgs.commonArgs.resumeThread, NULL);
-    pthread_mutex_init(&processThreadArgs.commonArgs.statusMutex, NULL);
+    initThreadArgs(&processThreadArgs.commonArgs);
     pthread_mutex_init(&processThreadArgs.entriesMutex, NULL);
 }
 
@@ -137,6 +173,7 @@ void initScreen(void) {
     CHECK_CURSES(curs_set(0));  // 커서 숨김
 
     initColors();
+    initFileClasses();  // 확장자별 색상 (LS_COLORS): 색상 Pair 추가 위해 initColors() 이후
 
     // 창 크기 가져옴
     int h, w;
@@ -145,6 +182,8 @@ void initScreen(void) {
     initTitleBar(w);  // 제목 창 (프로그램 이름 - 현재 경로 - 현재 시간) 생성
     initBottomBox(w, h - 3);  // 아래쪽 단축키 창 생성
     initPopupWindow();
+    initDebugOverlay();
+    initStatsWindow();
     initSelectionWindow();
     CHECK_CURSES(mvhline(1, 0, ACS_HLINE, w));  // 제목 창 아래로 가로줄 그림
     CHECK_CURSES(mvhline(h - 3, 0, ACS_HLINE, w));  // 단축키 창 위로 가로줄 그림
@@ -154,7 +193,11 @@ void initScreen(void) {
         initDirWin(
             &dirListenerArgs[i].bufMutex,
             &dirListenerArgs[i].totalReadItems,
-            dirListenerArgs[i].dirEntries
+            dirListenerArgs[i].dirEntries,
+            &dirListenerArgs[i].totalExtGroups,
+            dirListenerArgs[i].extGroups,
+            &dirListenerArgs[i].generation,
+            dirListenerArgs[i].nameIndex
         );
     }
     setDirWinCnt(1);
@@ -165,9 +208,27 @@ void initScreen(void) {
         &processThreadArgs.totalReadItems,
         processThreadArgs.processEntries
     );
+    initJobWindow();
 }
 
 void initThreads(void) {
+    static char listenerNames[MAX_DIRWINS][16];
+    static char fileOpNames[MAX_FILE_OPERATORS][16];
+
+    // 정렬 Worker Pool 시작 (Listener보다 먼저: 실패해도 단일 Thread로 정렬)
+    startSortPool();
+
+    // 통계 창에 표시할 Thread 등록
+    for (int i = 0; i < MAX_DIRWINS; i++) {
+        sprintf(listenerNames[i], "listener %d", i + 1);
+        addStatsThread(listenerNames[i], &dirListenerArgs[i].commonArgs);
+    }
+    for (int i = 0; i < MAX_FILE_OPERATORS; i++) {
+        sprintf(fileOpNames[i], "fileop %d", i + 1);
+        addStatsThread(fileOpNames[i], &fileOpArgs[i].commonArgs);
+    }
+    addStatsThread("process", &processThreadArgs.commonArgs);
+
     // Directory Listener Thread 초기화, 실행
     DIR *currentDir;
     for (int i = 0; i < MAX_DIRWINS; i++) {
@@ -185,14 +246,24 @@ void initThreads(void) {
     processThreadArgs.commonArgs.statusFlags |= THREAD_FLAG_PAUSE;  // 초기: 일시정지 된 상태로 시작
     startProcessThread(&threadProcess, &processThreadArgs);
 
-    // File Operator Thread 초기화, 실행
-    int pipeEnds[2];
-    assert(pipe(pipeEnds) == 0);
-    pipeFileOpCmd = pipeEnds[1];
-    for (int i = 0; i < MAX_FILE_OPERATORS; i++) {
-        fileOpArgs[i].pipeEnd = pipeEnds[0];
+    // File Operator Thread 초기화, 실행 (명령: 파일 작업 Queue에서 받음)
+    for (int i = 0; i < MAX_FILE_OPERATORS; i++)
         startFileOperator(&threadFileOperators[i], &fileOpArgs[i]);
-    }
+}
+
+/**
+ * 현재 창의 정렬 기준 변경 후, Listener에 새 정렬 Key 조합 전달
+ *
+ * @param criterion 정렬 기준 (DIRLISTENER_SORTKEY_NAME 등)
+ * @param append 기존 Key 뒤에 추가할지 여부 (toggleSortKey 참조)
+ */
+static void requestSort(int criterion, bool append) {
+    unsigned int curWin = getCurrentWindow();
+    uint16_t sortKeys = toggleSortKey(criterion, append);
+    pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
+    dirListenerArgs[curWin].sortKeys = sortKeys;
+    pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
+    pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
 }
 
 /**
@@ -205,6 +276,18 @@ static inline int normalKeyInput(int ch) {
     // File Task (copy/move 및 source 정보 등 저장)
     static FileTask fileTask = {
         .src.dirFd = -1,
+        .reflink = REFLINK_AUTO,
+        .cache = CACHE_NORMAL,
+    };
+    static const char *reflinkModeMsgs[REFLINK_MODE_CNT] = {
+        [REFLINK_AUTO] = "Paste: share extents if possible",
+        [REFLINK_ALWAYS] = "Paste: share extents only (reflink required)",
+        [REFLINK_NEVER] = "Paste: always copy data (no reflink)",
+    };
+    static const char *cacheModeMsgs[CACHE_MODE_CNT] = {
+        [CACHE_NORMAL] = "Paste: use page cache normally",
+        [CACHE_STREAM] = "Paste: streaming (drop copied data from page cache)",
+        [CACHE_DIRECT] = "Paste: streaming with O_DIRECT (bypass page cache)",
     };
     // File Task (Delete 전용: Copy/Move 원본 지정에 영향 미치지 않게)
     static FileTask fileDelTask = {
@@ -213,7 +296,22 @@ static inline int normalKeyInput(int ch) {
     static SrcDstInfo currentSelection;  // 선택 항목 확인용
 
     int cwdFd;  // 현재 선택된 창의 Working Directory File Descriptor
-    DIR *newCwd;
+
+    // Group 보기: 선택된 '파일'이 없음 -> 파일 관련 동작 불가
+    if (isGroupView()) {
+        switch (ch) {
+            case '\n':
+            case KEY_ENTER:
+            case KEY_F(2):
+            case CTRL_KEY('c'):
+            case CTRL_KEY('x'):
+            case CTRL_KEY('v'):
+            case KEY_DC:
+            case '/':
+                displayBottomMsg("Not available in group view", BOTTOM_MSG_USEC);
+                return 0;
+        }
+    }
 
     switch (ch) {
         // 창 이동
@@ -223,6 +321,23 @@ static inline int normalKeyInput(int ch) {
         case KEY_DOWN:
             moveCursorDown();
             break;
+        case KEY_PPAGE:
+            moveCursorPageUp();
+            break;
+        case KEY_NPAGE:
+            moveCursorPageDown();
+            break;
+        case KEY_HOME:
+            moveCursorHome();
+            break;
+        case KEY_END:
+            moveCursorEnd();
+            break;
+
+        // 이름으로 이동 창 토글
+        case '/':
+            state = JUMP_POPUP;
+            break;
 
         // 선택 항목 이동
         case KEY_LEFT:
@@ -239,16 +354,13 @@ static inline int normalKeyInput(int ch) {
             // 폴더인지 확인
             if (!S_ISDIR(currentSelection.mode)) {
                 // 폴더 아니면: 오류 표시
-                displayBottomMsg("Not a directory", FRAME_PER_SECOND);
+                displayBottomMsg("Not a directory", BOTTOM_MSG_USEC);
                 break;
             }
             curWin = getCurrentWindow();  // 현재 창 번호 가져옴
-            // 새 Working directory 경로 전달
-            pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-            strcpy(dirListenerArgs[curWin].newCwdPath, currentSelection.name);
-            pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-            // Working directory 변경 요청
+            // 새 Working directory 경로 전달 & 변경 요청
             pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
+            strcpy(dirListenerArgs[curWin].newCwdPath, currentSelection.name);
             dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_CHANGE_DIR;
             pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
             pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
@@ -282,30 +394,29 @@ static inline int normalKeyInput(int ch) {
         case 'P':
             state = PROCESS_WIN;
             break;
+        // 파일 작업 창 토글
+        case 'j':
+        case 'J':
+            state = JOB_WIN;
+            break;
 
         // 창 열기
         case CTRL_KEY('t'):
             if (visibleDirWins == MAX_DIRWINS) {
-                displayBottomMsg("Already opened max window", FRAME_PER_SECOND);
+                displayBottomMsg("Already opened max window", BOTTOM_MSG_USEC);
                 break;
             }
-            // 새 창의 Working Directory 설정
+            // 새 창의 Working Directory 설정: 현재 창 폴더의 fd 기준 "."으로 이동 요청 (실제 이동은 새 창의 Listener가 수행)
             curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-            cwdFd = dirfd(dirListenerArgs[curWin].currentDir);
+            cwdFd = dupListenerDirFd(&dirListenerArgs[curWin]);
             if (cwdFd != -1) {
-                cwdFd = openat(cwdFd, ".", directoryOpenArgs);  // readdir() 호출함 -> offset 등 공유하면 안 됨
-            }
-            pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-            if (cwdFd != -1) {
-                newCwd = fdopendir(cwdFd);
-                if (newCwd != NULL) {
-                    pthread_mutex_lock(&dirListenerArgs[visibleDirWins].dirMutex);
-                    if (dirListenerArgs[visibleDirWins].currentDir != NULL)
-                        closedir(dirListenerArgs[visibleDirWins].currentDir);
-                    dirListenerArgs[visibleDirWins].currentDir = newCwd;
-                    pthread_mutex_unlock(&dirListenerArgs[visibleDirWins].dirMutex);
-                }
+                pthread_mutex_lock(&dirListenerArgs[visibleDirWins].commonArgs.statusMutex);
+                if (dirListenerArgs[visibleDirWins].newCwdBaseFd != -1)  // 처리되지 않은 이전 요청
+                    close(dirListenerArgs[visibleDirWins].newCwdBaseFd);
+                dirListenerArgs[visibleDirWins].newCwdBaseFd = cwdFd;
+                strcpy(dirListenerArgs[visibleDirWins].newCwdPath, ".");
+                dirListenerArgs[visibleDirWins].commonArgs.statusFlags |= DIRLISTENER_FLAG_CHANGE_DIR;
+                pthread_mutex_unlock(&dirListenerArgs[visibleDirWins].commonArgs.statusMutex);
             }
             resumeThread(&dirListenerArgs[visibleDirWins].commonArgs);  // 새 창과 이어진 Thread 시작
             visibleDirWins++;
@@ -314,7 +425,7 @@ static inline int normalKeyInput(int ch) {
         // 현재 창 닫기
         case CTRL_KEY('r'):
             if (visibleDirWins == 1) {
-                displayBottomMsg("There is only one window", FRAME_PER_SECOND);
+                displayBottomMsg("There is only one window", BOTTOM_MSG_USEC);
                 break;
             }
             visibleDirWins--;
@@ -322,52 +433,37 @@ static inline int normalKeyInput(int ch) {
             pauseThread(&dirListenerArgs[visibleDirWins].commonArgs);  // 기존 창과 이어진 Thread 정지
             break;
 
-        // 정렬 변경
-        case 'w':  // F1 키 (이름 기준 오름차순)
-            toggleSort(SORT_NAME_MASK, SORT_NAME_SHIFT);
-            curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
-            // 현재 기준이 이름순인지 확인
-            if ((dirListenerArgs[curWin].commonArgs.statusFlags & DIRLISTENER_FLAG_SORT_CRITERION_MASK) == DIRLISTENER_FLAG_SORT_NAME) {
-                // 기준이 같다면 방향 토글
-                dirListenerArgs[curWin].commonArgs.statusFlags ^= DIRLISTENER_FLAG_SORT_REVERSE;
-            } else {
-                // 기준이 다르면 기준 초기화 및 오름차순 설정
-                dirListenerArgs[curWin].commonArgs.statusFlags &= ~(DIRLISTENER_FLAG_SORT_CRITERION_MASK | DIRLISTENER_FLAG_SORT_REVERSE);
-                dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_SORT_NAME;
-            }
-            pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
-            pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
+        // 정렬 변경 (소문자: 1순위 기준 설정/방향 전환, 대문자: 다음 순위 기준으로 추가/방향 전환)
+        case 'w':  // 이름 기준
+        case 'W':
+            requestSort(DIRLISTENER_SORTKEY_NAME, ch == 'W');
             break;
-        case 'e':  // F2 키 (크기 기준 오름차순)
-            toggleSort(SORT_SIZE_MASK, SORT_SIZE_SHIFT);
-            curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
-            // 현재 기준이 크기순인지 확인
-            if ((dirListenerArgs[curWin].commonArgs.statusFlags & DIRLISTENER_FLAG_SORT_CRITERION_MASK) == DIRLISTENER_FLAG_SORT_SIZE) {
-                // 기준이 같다면 방향 토글
-                dirListenerArgs[curWin].commonArgs.statusFlags ^= DIRLISTENER_FLAG_SORT_REVERSE;
-            } else {
-                // 기준이 다르면 기준 초기화 및 오름차순 설정
-                dirListenerArgs[curWin].commonArgs.statusFlags &= ~(DIRLISTENER_FLAG_SORT_CRITERION_MASK | DIRLISTENER_FLAG_SORT_REVERSE);
-                dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_SORT_SIZE;
-            }
-            pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
-            pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
+        case 'e':  // 크기 기준
+        case 'E':
+            requestSort(DIRLISTENER_SORTKEY_SIZE, ch == 'E');
+            break;
+        case 'r':  // 날짜 기준
+        case 'R':
+            requestSort(DIRLISTENER_SORTKEY_DATE, ch == 'R');
+            break;
+        case 't':  // 확장자 기준
+        case 'T':
+            requestSort(DIRLISTENER_SORTKEY_EXT, ch == 'T');
             break;
-        case 'r':  // F3 키 (날짜 기준 오름차순)
-            toggleSort(SORT_DATE_MASK, SORT_DATE_SHIFT);
+        case 'y':  // 파일 종류 기준
+        case 'Y':
+            requestSort(DIRLISTENER_SORTKEY_TYPE, ch == 'Y');
+            break;
+
+        // 확장자별 Group 보기 전환
+        case 'g':
+        case 'G':
             curWin = getCurrentWindow();
             pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
-            // 현재 기준이 날짜순인지 확인
-            if ((dirListenerArgs[curWin].commonArgs.statusFlags & DIRLISTENER_FLAG_SORT_CRITERION_MASK) == DIRLISTENER_FLAG_SORT_DATE) {
-                // 기준이 같다면 방향 토글
-                dirListenerArgs[curWin].commonArgs.statusFlags ^= DIRLISTENER_FLAG_SORT_REVERSE;
-            } else {
-                // 기준이 다르면 기준 초기화 및 오름차순 설정
-                dirListenerArgs[curWin].commonArgs.statusFlags &= ~(DIRLISTENER_FLAG_SORT_CRITERION_MASK | DIRLISTENER_FLAG_SORT_REVERSE);
-                dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_SORT_DATE;
-            }
+            if (toggleGroupView())
+                dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_GROUP_EXT;
+            else
+                dirListenerArgs[curWin].commonArgs.statusFlags &= ~DIRLISTENER_FLAG_GROUP_EXT;
             pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
             pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
             break;
@@ -392,27 +488,37 @@ static inline int normalKeyInput(int ch) {
             }
             // 현재 폴더의 fd 가져옴
             curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-            fileTask.src.dirFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
-            pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-            displayBottomMsg((ch == CTRL_KEY('c')) ? "File copied" : "File cutted", FRAME_PER_SECOND);
+            fileTask.src.dirFd = dupListenerDirFd(&dirListenerArgs[curWin]);  // 목록과 함께 게시된 fd: 파일 시스템 멈춰도 대기 X
+            displayBottomMsg((ch == CTRL_KEY('c')) ? "File copied" : "File cutted", BOTTOM_MSG_USEC);
             break;
         case CTRL_KEY('v'):  // 붙여넣기: 미리 복사/잘라내기 된 파일 있으면 수행, 없으면 오류 표시
             if (fileTask.src.dirFd == -1) {  // 선택된 파일 없음
-                displayBottomMsg("No file selected", FRAME_PER_SECOND);
+                displayBottomMsg("No file selected", BOTTOM_MSG_USEC);
                 break;
             }
             fileTask.dst = getCurrentSelectedItem();  // 현재 선택된 Item 정보 가져옴
             strcpy(fileTask.dst.name, fileTask.src.name);  // 목적지 이름 설정 (Rename Operation 대비)
             // 현재 폴더의 fd 가져옴
             curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-            fileTask.dst.dirFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
-            pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-            // pipe에 명령 쓰기
-            write(pipeFileOpCmd, &fileTask, sizeof(FileTask));  // 구조체 크기 < PIPE_BUF(=4096) -> Atomic, 별도 보호 불필요
+            fileTask.dst.dirFd = dupListenerDirFd(&dirListenerArgs[curWin]);  // 목록과 함께 게시된 fd: 파일 시스템 멈춰도 대기 X
+            // 작업 Queue에 추가 (fd들: Queue가 넘겨받음)
+            if (submitFileJob(&fileTask) == 0)
+                displayBottomMsg(FILE_JOB_QUEUE_FULL, BOTTOM_MSG_USEC);
+            else
+                displayBottomMsg("File action requested", BOTTOM_MSG_USEC);
             fileTask.src.dirFd = -1;  // '덮어쓰기'될 fd 아님: 다음 Copy/Move 대상 지정 시, close 방지
-            displayBottomMsg("File action requested", FRAME_PER_SECOND);
+            break;
+        // 붙여넣기 시 Extent 공유 (Reflink) 여부 전환: 이후 붙여넣기에 적용
+        case 'o':
+        case 'O':
+            fileTask.reflink = (fileTask.reflink + 1) % REFLINK_MODE_CNT;
+            displayBottomMsg(reflinkModeMsgs[fileTask.reflink], BOTTOM_MSG_USEC);
+            break;
+        // 붙여넣기 시 Page Cache 사용 방식 (Streaming) 전환: 이후 붙여넣기에 적용
+        case 'b':
+        case 'B':
+            fileTask.cache = (fileTask.cache + 1) % CACHE_MODE_CNT;
+            displayBottomMsg(cacheModeMsgs[fileTask.cache], BOTTOM_MSG_USEC);
             break;
         case KEY_DC:  // Delete 키
             // fileTask.type = DELETE;  // '삭제' 전용 변수: 종류 대입 불필요
@@ -426,12 +532,21 @@ static inline int normalKeyInput(int ch) {
             }
             // 현재 폴더의 fd 가져옴
             curWin = getCurrentWindow();
-            pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-            fileDelTask.src.dirFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
-            pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-            // pipe에 명령 쓰기
-            write(pipeFileOpCmd, &fileDelTask, sizeof(FileTask));  // 구조체 크기 < PIPE_BUF(=4096) -> Atomic, 별도 보호 불필요
-            displayBottomMsg("File delete requested", FRAME_PER_SECOND);
+            fileDelTask.src.dirFd = dupListenerDirFd(&dirListenerArgs[curWin]);  // 목록과 함께 게시된 fd: 파일 시스템 멈춰도 대기 X
+            // 작업 Queue에 추가 (fd들: Queue가 넘겨받음)
+            if (submitFileJob(&fileDelTask) == 0)
+                displayBottomMsg(FILE_JOB_QUEUE_FULL, BOTTOM_MSG_USEC);
+            else
+                displayBottomMsg("File delete requested", BOTTOM_MSG_USEC);
+            break;
+
+        // 화면 갱신 정보 표시 전환
+        case KEY_F(12):
+            toggleDebugOverlay();
+            break;
+        // Thread 통계 표시 전환
+        case KEY_F(11):
+            toggleStatsWindow();
             break;
 
         // 종료
@@ -444,13 +559,13 @@ static inline int normalKeyInput(int ch) {
 
 void mainLoop(void) {
     struct timespec startTime;  // Iteration 시작 시간
-    uint64_t elapsedUSec;  // Iteration 걸린 시간
+    uint32_t wakeSources = UI_WAKE_DATA;  // 이번 Frame 깨운 원인들 (UI_WAKE_*)
+    uint64_t frameIntervalUSec = 0;  // 이번 Frame에 적용된 최소 갱신 간격
 
-    int cwdFd;  // 현재 선택된 창의 Working Directory File Descriptor
-    ssize_t cwdLen;
     char tmpBuf[PATH_MAX];  // 각종 임시 문자열 저장 Buffer
     char pathBuf[PATH_MAX];  // 각종 경로 저장 Buffer
     pid_t selectionPid = 0;  // 선택한 Process PID
+    size_t jumpPrefixLen = 0;  // 이름으로 이동 창에 입력된 길이
     FileTask fileTask = {};
 
     unsigned int curWin;  // 현재 창
@@ -466,6 +581,7 @@ void mainLoop(void) {
 #pragma GCC diagnostic ignored "-Wanalyzer-fd-leak"
     while (1) {
         clock_gettime(CLOCK_MONOTONIC, &startTime);  // 시작 시간 가져옴
+        FRAME_STAGE_BEGIN();  // F12 Overlay: 구간별 시간 측정 (숨김: 측정 X)
 
         // 키 입력 처리
         for (int ch = wgetch(stdscr); ch != ERR; ch = wgetch(stdscr)) {
@@ -486,6 +602,28 @@ void mainLoop(void) {
                     if (ch == 'p' || ch == 'P')
                         state = NORMAL;
                     break;
+                case JOB_WIN:
+                    if (ch == KEY_DOWN)
+                        selectNextJob();
+                    if (ch == KEY_UP)
+                        selectPreviousJob();
+                    if (ch == 'x' || ch == 'X' || ch == KEY_DC) {
+                        if (cancelSelectedJob() == -1)
+                            displayBottomMsg("No job to cancel", BOTTOM_MSG_USEC);
+                    }
+                    if (ch == ' ') {
+                        if (togglePauseSelectedJob() == -1)
+                            displayBottomMsg("Job already finished", BOTTOM_MSG_USEC);
+                    }
+                    if (ch == '+' || ch == '=' || ch == '-') {
+                        if (changeSelectedJobPriority(ch != '-') == -1)
+                            displayBottomMsg("Cannot change priority", BOTTOM_MSG_USEC);
+                    }
+                    if (ch == 'q' || ch == 'Q')
+                        goto CLEANUP;
+                    if (ch == 'j' || ch == 'J')
+                        state = NORMAL;
+                    break;
                 case PROCESS_TERM_POPUP:
                     if (ch == KEY_LEFT) {
                         selectionWindowSelPrevious();
@@ -495,16 +633,16 @@ void mainLoop(void) {
                         switch (selectionWindowGetSel()) {
                             case 0:  // Kill
                                 if (kill(selectionPid, SIGTERM) == -1) {
-                                    displayBottomMsg("Failed to terminate process", FRAME_PER_SECOND);
+                                    displayBottomMsg("Failed to terminate process", BOTTOM_MSG_USEC);
                                 } else {
-                                    displayBottomMsg("Sucessfully terminateed process", FRAME_PER_SECOND);
+                                    displayBottomMsg("Sucessfully terminateed process", BOTTOM_MSG_USEC);
                                 }
                                 break;
                             case 1:  // Stop
                                 if (kill(selectionPid, SIGKILL) == -1) {
-                                    displayBottomMsg("Failed to kill process", FRAME_PER_SECOND);
+                                    displayBottomMsg("Failed to kill process", BOTTOM_MSG_USEC);
                                 } else {
-                                    displayBottomMsg("Sucessfully killed process", FRAME_PER_SECOND);
+                                    displayBottomMsg("Sucessfully killed process", BOTTOM_MSG_USEC);
                                 }
                                 break;
                             case 2:  // Cancel
@@ -531,13 +669,13 @@ void mainLoop(void) {
                         getStringFromPopup(fileTask.dst.name);
                         // 현재 폴더의 fd 가져옴
                         curWin = getCurrentWindow();
-                        pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-                        fileTask.src.dirFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
+                        fileTask.src.dirFd = dupListenerDirFd(&dirListenerArgs[curWin]);  // 목록과 함께 게시된 fd: 파일 시스템 멈춰도 대기 X
                         fileTask.dst.dirFd = fileTask.src.dirFd;
-                        pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-                        // pipe에 명령 쓰기
-                        write(pipeFileOpCmd, &fileTask, sizeof(FileTask));  // 구조체 크기 < PIPE_BUF(=4096) -> Atomic, 별도 보호 불필요
-                        displayBottomMsg("Rename requested", FRAME_PER_SECOND);
+                        // 작업 Queue에 추가 (fd들: Queue가 넘겨받음)
+                        if (submitFileJob(&fileTask) == 0)
+                            displayBottomMsg(FILE_JOB_QUEUE_FULL, BOTTOM_MSG_USEC);
+                        else
+                            displayBottomMsg("Rename requested", BOTTOM_MSG_USEC);
                         // 창 닫기
                         state = NORMAL;
                     } else if (ch == KEY_F(2)) {
@@ -555,11 +693,9 @@ void mainLoop(void) {
                         // Working directory 변경 수행
                         // 팝업창에서 경로 가져오기
                         curWin = getCurrentWindow();
-                        pthread_mutex_lock(&dirListenerArgs[curWin].bufMutex);
+                        pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
                         getStringFromPopup(dirListenerArgs[curWin].newCwdPath);
                         dirListenerArgs[curWin].commonArgs.statusFlags |= DIRLISTENER_FLAG_CHANGE_DIR;
-                        pthread_mutex_unlock(&dirListenerArgs[curWin].bufMutex);
-                        pthread_mutex_lock(&dirListenerArgs[curWin].commonArgs.statusMutex);
                         pthread_cond_signal(&dirListenerArgs[curWin].commonArgs.resumeThread);
                         pthread_mutex_unlock(&dirListenerArgs[curWin].commonArgs.statusMutex);
                         setCurrentSelection(0);
@@ -583,18 +719,42 @@ void mainLoop(void) {
                         getStringFromPopup(fileTask.src.name);
                         // 현재 폴더의 fd 가져옴
                         curWin = getCurrentWindow();
-                        pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-                        fileTask.src.dirFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
-                        pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-                        // pipe에 명령 쓰기
-                        write(pipeFileOpCmd, &fileTask, sizeof(FileTask));  // 구조체 크기 < PIPE_BUF(=4096) -> Atomic, 별도 보호 불필요
-                        displayBottomMsg("Create directory requested", FRAME_PER_SECOND);
+                        fileTask.src.dirFd = dupListenerDirFd(&dirListenerArgs[curWin]);  // 목록과 함께 게시된 fd: 파일 시스템 멈춰도 대기 X
+                        // 작업 Queue에 추가 (fd들: Queue가 넘겨받음)
+                        if (submitFileJob(&fileTask) == 0)
+                            displayBottomMsg(FILE_JOB_QUEUE_FULL, BOTTOM_MSG_USEC);
+                        else
+                            displayBottomMsg("Create directory requested", BOTTOM_MSG_USEC);
                         // 창 닫기
                         state = NORMAL;
                     } else if (ch == CTRL_KEY('n')) {
                         state = NORMAL;  // 창 닫기
                     }
                     break;
+                case JUMP_POPUP:
+                    // 입력할 때마다 이동: 이름 앞부분이 입력한 문자열인 첫 항목
+                    if (' ' <= ch && ch <= '~' && jumpPrefixLen < MAX_JUMP_PREFIX_LEN) {
+                        putCharToPopup(ch);
+                        jumpPrefixLen++;
+                    } else if (ch == KEY_BACKSPACE && jumpPrefixLen > 0) {
+                        popCharFromPopup();
+                        jumpPrefixLen--;
+                    } else if (ch == KEY_UP) {
+                        moveCursorUp();
+                        break;
+                    } else if (ch == KEY_DOWN) {
+                        moveCursorDown();
+                        break;
+                    } else if (ch == '\n' || ch == 27) {  // Enter, ESC
+                        jumpPrefixLen = 0;
+                        state = NORMAL;  // 창 닫기
+                        break;
+                    } else {
+                        break;
+                    }
+                    getStringFromPopup(tmpBuf);
+                    jumpToNamePrefix(tmpBuf);
+                    break;
                 case WARNING_POPUP:
                     if (ch == '\n') {
                         state = NORMAL;
@@ -602,21 +762,22 @@ void mainLoop(void) {
                     break;
             }
         }
+        FRAME_STAGE_END(FRAME_STAGE_INPUT);
 
         if (state == NORMAL) {
             // 폴더 변경 실패 시, 오류 표시
             for (int i = 0; i < visibleDirWins; i++) {
-                if (pthread_mutex_trylock(&dirListenerArgs[i].commonArgs.statusMutex) == -1)  // 중요한 것 X -> 획득 대기로 인한 지연 방지
+                if (pthread_mutex_trylock(&dirListenerArgs[i].commonArgs.statusMutex) != 0)  // 중요한 것 X -> 획득 대기로 인한 지연 방지
                     continue;
                 if (dirListenerArgs[i].commonArgs.statusFlags & DIRLISTENER_FLAG_CHDIR_FAIL) {
-                    displayBottomMsg("Failed to change directory", FRAME_PER_SECOND);
+                    displayBottomMsg("Failed to change directory", BOTTOM_MSG_USEC);
                     dirListenerArgs[i].commonArgs.statusFlags &= ~DIRLISTENER_FLAG_CHDIR_FAIL;
                 }
                 pthread_mutex_unlock(&dirListenerArgs[i].commonArgs.statusMutex);
             }
             // 진행된 파일 작업 있으면 -> 하단 알림 표시 & 모든 창 새로고침
             for (int i = 0; i < MAX_FILE_OPERATORS; i++) {
-                if (pthread_mutex_trylock(&fileProgresses[i].flagMutex) == -1)  // 중요한 것 X -> 획득 대기로 인한 지연 방지
+                if (pthread_mutex_trylock(&fileProgresses[i].flagMutex) != 0)  // 중요한 것 X -> 획득 대기로 인한 지연 방지
                     continue;
                 if (fileProgresses[i].flags & PROGRESS_PREV_MASK) {
                     refreshFileWindows = true;
@@ -624,32 +785,32 @@ void mainLoop(void) {
                         // 직전 동작 실패
                         switch (fileProgresses[i].flags & PROGRESS_PREV_MASK) {
                             case PROGRESS_PREV_CP:
-                                displayBottomMsg("Failed to copy", FRAME_PER_SECOND);
+                                displayBottomMsg("Failed to copy", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_MV:
-                                displayBottomMsg("Failed to move/rename", FRAME_PER_SECOND);
+                                displayBottomMsg("Failed to move/rename", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_RM:
-                                displayBottomMsg("Failed to remove", FRAME_PER_SECOND);
+                                displayBottomMsg("Failed to remove", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_MKDIR:
-                                displayBottomMsg("Failed to create new directory", FRAME_PER_SECOND);
+                                displayBottomMsg("Failed to create new directory", BOTTOM_MSG_USEC);
                                 break;
                         }
                     } else {
                         // 직전 동작 성공
                         switch (fileProgresses[i].flags & PROGRESS_PREV_MASK) {
                             case PROGRESS_PREV_CP:
-                                displayBottomMsg("Successfully copied", FRAME_PER_SECOND);
+                                displayBottomMsg("Successfully copied", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_MV:
-                                displayBottomMsg("Successfully moved/renamed", FRAME_PER_SECOND);
+                                displayBottomMsg("Successfully moved/renamed", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_RM:
-                                displayBottomMsg("Successfully removed", FRAME_PER_SECOND);
+                                displayBottomMsg("Successfully removed", BOTTOM_MSG_USEC);
                                 break;
                             case PROGRESS_PREV_MKDIR:
-                                displayBottomMsg("Successfully created new directory", FRAME_PER_SECOND);
+                                displayBottomMsg("Successfully created new directory", BOTTOM_MSG_USEC);
                                 break;
                         }
                     }
@@ -667,32 +828,33 @@ void mainLoop(void) {
         } else {
             // (가능한) 각 File operator 직전 결과 삭제
             for (int i = 0; i < MAX_FILE_OPERATORS; i++) {
-                if (pthread_mutex_trylock(&fileProgresses[i].flagMutex) == -1)
+                if (pthread_mutex_trylock(&fileProgresses[i].flagMutex) != 0)
                     continue;
                 fileProgresses[i].flags &= ~PROGRESS_PREV_MASK;
                 pthread_mutex_unlock(&fileProgresses[i].flagMutex);
             }
         }
+        FRAME_STAGE_END(FRAME_STAGE_PROGRESS);
 
-        // 현재 창의 Working Directory 가져옴
+        // 현재 창의 Working Directory 표시: Listener가 폴더 바뀔 때마다 확인해 목록과 함께 게시
         curWin = getCurrentWindow();
-        pthread_mutex_lock(&dirListenerArgs[curWin].dirMutex);
-        cwdFd = dup(dirfd(dirListenerArgs[curWin].currentDir));
-        pthread_mutex_unlock(&dirListenerArgs[curWin].dirMutex);
-        if (snprintf(tmpBuf, PATH_MAX, "/proc/self/fd/%d", cwdFd) == PATH_MAX) {
-            cwdLen = -1;
-        } else {
-            cwdLen = readlink(tmpBuf, pathBuf, PATH_MAX);
-        }
-        close(cwdFd);
-
-        if (cwdLen == -1) {
+        pthread_mutex_lock(&dirListenerArgs[curWin].bufMutex);
+        if (dirListenerArgs[curWin].cwdPathLen == 0) {
             updateTitleBar("-----", (size_t)5);
         } else {
-            updateTitleBar(pathBuf, (size_t)cwdLen);
+            updateTitleBar(dirListenerArgs[curWin].cwdPath, dirListenerArgs[curWin].cwdPathLen);
         }
+        pthread_mutex_unlock(&dirListenerArgs[curWin].bufMutex);
+        for (int i = 0; i < visibleDirWins; i++)  // 파일 시스템 호출에서 멈춘 Listener: 창에 표시 (매초 Timer로 깨어나 확인)
+            setDirWinUnresponsive(i, isListenerUnresponsive(&dirListenerArgs[i]));
+        for (int i = 0; i < MAX_DIRWINS; i++)  // 새로고침 간격: 선택된 창 > 보이는 창 (숨겨진 창: 일시정지)
+            setListenerFocus(&dirListenerArgs[i], i < visibleDirWins && i == curWin);
+        FRAME_STAGE_END(FRAME_STAGE_TITLE);
+        TRACE_BEGIN(dirWinsStartUSec);
         updateDirWins();  // 폴더 표시 창들 업데이트
+        TRACE_END(dirWinsStartUSec, "updateDirWins");
         updateBottomBox(fileProgresses);
+        FRAME_STAGE_END(FRAME_STAGE_DIRWINS);
 
         switch (state) {
             case PROCESS_WIN:
@@ -705,6 +867,10 @@ void mainLoop(void) {
                 }
                 updateProcessWindow();
                 break;
+            case JOB_WIN:
+                prevState = JOB_WIN;
+                updateJobWindow();
+                break;
             case PROCESS_TERM_POPUP:
                 if (prevState != PROCESS_TERM_POPUP) {
                     getSelectedProcess(&selectionPid, pathBuf, sizeof(pathBuf));
@@ -737,6 +903,13 @@ void mainLoop(void) {
                 }
                 updatePopupWindow();
                 break;
+            case JUMP_POPUP:
+                if (prevState != JUMP_POPUP) {
+                    showPopupWindow("Jump to name");
+                    prevState = JUMP_POPUP;
+                }
+                updatePopupWindow();
+                break;
             case WARNING_POPUP:
                 prevState = WARNING_POPUP;
                 updateSelectionWindow();
@@ -747,7 +920,10 @@ void mainLoop(void) {
                     hideProcessWindow();
                     pauseThread(&processThreadArgs.commonArgs);
                     prevState = NORMAL;
-                } else if (prevState == RENAME_POPUP || prevState == CHDIR_POPUP || prevState == MKDIR_POPUP) {
+                } else if (prevState == JOB_WIN) {
+                    hideJobWindow();
+                    prevState = NORMAL;
+                } else if (prevState == RENAME_POPUP || prevState == CHDIR_POPUP || prevState == MKDIR_POPUP || prevState == JUMP_POPUP) {
                     hidePopupWindow();
                     prevState = NORMAL;
                 } else if (prevState == WARNING_POPUP) {
@@ -756,45 +932,148 @@ void mainLoop(void) {
                 }
                 break;
         }
+        FRAME_STAGE_END(FRAME_STAGE_WINDOWS);
+
+        updateDebugOverlay(wakeSources, frameIntervalUSec);
+        updateStatsWindow();
 
         // 패널 업데이트
+        TRACE_BEGIN(drawStartUSec);
         update_panels();
         doupdate();
+        TRACE_END(drawStartUSec, "doupdate");
+        FRAME_STAGE_END(FRAME_STAGE_DRAW);  // 키 입력 ~ 화면 반영 지연도 여기까지
 
-        // Frame rate 제한: delay - 경과 time
-        elapsedUSec = getElapsedTime(startTime);
-        if (FRAME_INTERVAL_USEC > elapsedUSec) {
-            usleep(FRAME_INTERVAL_USEC - elapsedUSec);  // Main thread 일시정지
-        }
+        // 다음 Event까지 대기
+        wakeSources = waitForEvents(startTime, &frameIntervalUSec);
     }
 CLEANUP:
     return;
 }
 #pragma GCC diagnostic pop
 
-static inline void tryJoinThread(ThreadArgs *commonArgs, pthread_t *threadToWait) {
+/**
+ * 다음 Frame 그릴 때까지 대기
+ *
+ * @param lastFrameTime 직전 Frame 시작 시간 (Clock: CLOCK_MONOTONIC)
+ * @param frameIntervalUSec 적용한 최소 갱신 간격 저장할 곳 (0: 제한 없음)
+ * @return 깨운 원인들 (UI_WAKE_* bitmask)
+ *
+ * @details
+ * - 키 입력, 창 크기 변경, Thread 알림 (eventfd), 시계/하단 메시지 갱신 시간 중 하나까지 대기
+ * - 원인에 따라 직전 Frame부터 최소 간격 유지: 키 입력 `INPUT_FRAME_INTERVAL_USEC`, 새 결과 `FRAME_INTERVAL_USEC`, 진행률 `PROGRESS_FRAME_INTERVAL_USEC`
+ * - 간격 채우는 동안 들어온 키 입력, 알림: 모두 모아서 한 Frame에 반영
+ */
+uint32_t waitForEvents(struct timespec lastFrameTime, uint64_t *frameIntervalUSec) {
+    struct pollfd fds[3] = {
+        { .fd = STDIN_FILENO, .events = POLLIN },
+        { .fd = sigWinchFd, .events = POLLIN },
+        { .fd = uiNotifyFd, .events = POLLIN }
+    };
+    struct timespec now;
+    int timeoutMs;
+    uint32_t wakeSources = 0;
+    uint64_t intervalUSec, elapsedUSec;
+
+    // 시간 제한: 제목 창 시계의 다음 초, 하단 메시지 사라질 시간 중 먼저 오는 것
+    clock_gettime(CLOCK_REALTIME, &now);
+    timeoutMs = 1000 - now.tv_nsec / (1000 * 1000);
+    uint64_t msgLeftUSec = getBottomMsgRemainingTime();
+    if (msgLeftUSec > 0 && (msgLeftUSec + 999) / 1000 < (uint64_t)timeoutMs)
+        timeoutMs = (msgLeftUSec + 999) / 1000;
+
+    switch (poll(fds, 3, timeoutMs)) {
+        case 0:  // 시간 초과
+            *frameIntervalUSec = 0;
+            return UI_WAKE_TIMER;
+        case -1:  // EINTR (SIGINT: ungetch()된 키 처리)
+            *frameIntervalUSec = 0;
+            return UI_WAKE_KEY;
+    }
+
+    if (fds[0].revents & POLLIN) {
+        wakeSources |= UI_WAKE_KEY;
+        FRAME_KEY_ARRIVED();
+    }
+    if (fds[1].revents & POLLIN) {
+        // 창 크기 변경: ncurses에 새 크기 반영 (KEY_RESIZE 입력됨)
+        struct signalfd_siginfo info;
+        struct winsize size;
+        while (read(sigWinchFd, &info, sizeof(info)) == sizeof(info)) { }
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0)
+            resizeterm(size.ws_row, size.ws_col);
+        wakeSources |= UI_WAKE_RESIZE;
+    }
+    if (fds[2].revents & POLLIN)
+        wakeSources |= clearUiNotification();
+
+    // 가장 급한 원인 기준으로 최소 간격 결정
+    if (wakeSources & (UI_WAKE_KEY | UI_WAKE_RESIZE))
+        intervalUSec = INPUT_FRAME_INTERVAL_USEC;
+    else if (wakeSources & UI_WAKE_DATA)
+        intervalUSec = FRAME_INTERVAL_USEC;
+    else
+        intervalUSec = PROGRESS_FRAME_INTERVAL_USEC;
+
+    // 간격 채울 때까지 대기
+    for (elapsedUSec = getElapsedTime(lastFrameTime); elapsedUSec < intervalUSec; elapsedUSec = getElapsedTime(lastFrameTime)) {
+        int waitMs = (intervalUSec - elapsedUSec + 999) / 1000;
+        if (wakeSources & UI_WAKE_KEY) {
+            poll(NULL, 0, waitMs);  // 키 반복 입력: 그 사이 입력된 키는 다음 Frame에서 한 번에 처리
+            break;
+        }
+        if (poll(fds, 1, waitMs) <= 0)  // 알림만 있음: 키 입력 들어오면 더 짧은 간격 적용
+            break;
+        wakeSources |= UI_WAKE_KEY;
+        FRAME_KEY_ARRIVED();
+        intervalUSec = INPUT_FRAME_INTERVAL_USEC;
+    }
+    wakeSources |= clearUiNotification();  // 기다리는 동안 쌓인 알림: 이번 Frame에서 같이 반영
+
+    *frameIntervalUSec = intervalUSec;
+    return wakeSources;
+}
+
+// Thread 종료 대기 (Return: 종료됨 or 실행 중 아님 -> true, 시간 초과 -> false)
+static inline bool tryJoinThread(ThreadArgs *commonArgs, pthread_t *threadToWait, const struct timespec *deadline) {
     pthread_mutex_lock(&commonArgs->statusMutex);
     if (commonArgs->statusFlags & THREAD_FLAG_RUNNING) {
         pthread_mutex_unlock(&commonArgs->statusMutex);
-        pthread_join(*threadToWait, NULL);
-    } else {
-        pthread_mutex_unlock(&commonArgs->statusMutex);
+        if (deadline == NULL)
+            return pthread_join(*threadToWait, NULL) == 0;
+        return pthread_timedjoin_np(*threadToWait, NULL, deadline) == 0;  // 시간 초과: 대기 포기 (프로세스 종료 시 함께 종료됨)
     }
+    pthread_mutex_unlock(&commonArgs->statusMutex);
+    return true;
 }
 
 void stopThreads(void) {
+    struct timespec deadline;
+
     // Thread들 정지 요청
-    close(pipeFileOpCmd);  // File Operator Thread용 pipe의 write end: close() -> Thread들 순차적으로 정지됨
+    closeFileJobQueue();  // 파일 작업 Queue 닫음: 남은 작업 끝나면 File Operator Thread들 정지됨
     for (int i = 0; i < MAX_DIRWINS; i++)
         stopThread(&dirListenerArgs[i].commonArgs);
     stopThread(&processThreadArgs.commonArgs);
 
     // 각 Thread들 대기
+    // Listener: 응답 없는 파일 시스템에서 멈춰 있을 수 있음 -> 모두 합쳐 최대 THREAD_JOIN_TIMEOUT_USEC만 대기
+    clock_gettime(CLOCK_REALTIME, &deadline);  // pthread_timedjoin_np(): CLOCK_REALTIME 기준
+    deadline.tv_sec += THREAD_JOIN_TIMEOUT_USEC / 1000000;
+    deadline.tv_nsec += (THREAD_JOIN_TIMEOUT_USEC % 1000000) * 1000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    bool isListenersJoined = true;
     for (int i = 0; i < MAX_DIRWINS; i++)
-        tryJoinThread(&dirListenerArgs[i].commonArgs, &threadListDir[i]);
+        isListenersJoined &= tryJoinThread(&dirListenerArgs[i].commonArgs, &threadListDir[i], &deadline);
+    // File Operator: 진행 중인 작업 완료까지 대기
     for (int i = 0; i < MAX_FILE_OPERATORS; i++)
-        tryJoinThread(&fileOpArgs[i].commonArgs, &threadFileOperators[i]);
-    tryJoinThread(&processThreadArgs.commonArgs, &threadProcess);
+        tryJoinThread(&fileOpArgs[i].commonArgs, &threadFileOperators[i], NULL);
+    tryJoinThread(&processThreadArgs.commonArgs, &threadProcess, NULL);
+    if (isListenersJoined)  // Listener들 모두 정지 후에만 (정렬 중인 Listener 없음)
+        stopSortPool();  // 남은 Listener 있음: 정렬 요청할 수 있으므로 Pool 유지 (프로세스 종료 시 함께 종료됨)
 
     // Linux에서: pthread_mutex_destroy, pthread_cond_destroy 반드시 필요한 것 아님 (manpage 참조)
 }
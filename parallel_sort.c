@@ -0,0 +1,333 @@
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "parallel_sort.h"
+
+
+/**
+ * @struct _SortTask
+ *
+ * @var _SortTask::src 정렬할 구간 (병합 시: 앞 구간)
+ * @var _SortTask::srcCnt src의 항목 수
+ * @var _SortTask::other 병합할 뒤 구간 (NULL: 정렬 작업)
+ * @var _SortTask::otherCnt other의 항목 수
+ * @var _SortTask::dst 병합 결과 저장 위치
+ */
+typedef struct _SortTask {
+    char *src;  // 정렬할 구간 (병합 시: 앞 구간)
+    size_t srcCnt;  // src의 항목 수
+    char *other;  // 병합할 뒤 구간 (NULL: 정렬 작업)
+    size_t otherCnt;  // other의 항목 수
+    char *dst;  // 병합 결과 저장 위치
+} SortTask;
+
+
+static pthread_t workers[MAX_SORT_THREADS];
+static size_t totalWorkers;  // 생성된 Worker 수 (호출 Thread 제외)
+static bool isPoolStarted;
+
+static pthread_mutex_t poolMutex = PTHREAD_MUTEX_INITIALIZER;  // Pool 사용권 (한 번에 1개의 정렬만 Pool 사용)
+static pthread_mutex_t taskMutex = PTHREAD_MUTEX_INITIALIZER;  // 아래 작업 관련 변수들 보호 Mutex
+static pthread_cond_t taskReady = PTHREAD_COND_INITIALIZER;  // 새 작업 묶음 알림
+static pthread_cond_t taskDone = PTHREAD_COND_INITIALIZER;  // 작업 묶음 완료 알림
+
+static SortTask tasks[MAX_SORT_THREADS * 2];  // 현재 작업 묶음
+static size_t totalTasks;  // 현재 작업 묶음의 작업 수
+static size_t nextTask;  // 다음에 가져갈 작업 Index
+static size_t pendingTasks;  // 아직 끝나지 않은 작업 수
+static uint64_t taskGeneration;  // 작업 묶음 번호 (Worker가 새 묶음 감지용)
+static bool stopRequested;
+
+// 현재 정렬 중인 배열 정보 (작업 묶음 수행 중에만 유효)
+static size_t curItemSize;
+static int (*curCompare)(const void *, const void *, void *);
+static void *curArg;
+
+
+/**
+ * Worker Thread 함수: 작업 묶음 대기 -> 작업 수행 반복
+ *
+ * @param arg 사용하지 않음
+ * @return 없음
+ */
+static void *sortWorker(void *arg);
+
+/**
+ * 현재 작업 묶음에서 작업을 하나씩 가져와 수행 (남은 작업 없을 때까지)
+ */
+static void runPendingTasks(void);
+
+/**
+ * 작업 묶음 실행 (Worker들과 함께 수행, 모두 끝날 때까지 대기)
+ *
+ * @param taskCnt tasks 배열에 채워진 작업 수
+ */
+static void dispatchTasks(size_t taskCnt);
+
+/**
+ * 작업 1개 수행 (정렬 or 병합)
+ *
+ * @param task 수행할 작업
+ */
+static void runTask(const SortTask *task);
+
+/**
+ * 두 정렬된 구간을 병합한 결과의 k번째 위치에서, 앞 구간이 차지하는 항목 수 계산 (merge path)
+ *
+ * @param left 앞 구간
+ * @param leftCnt 앞 구간 항목 수
+ * @param right 뒤 구간
+ * @param rightCnt 뒤 구간 항목 수
+ * @param k 병합 결과에서의 위치
+ * @return 병합 결과 [0, k) 중 앞 구간에서 온 항목 수 (같은 값: 앞 구간 우선 -> 안정 병합)
+ */
+static size_t findMergeSplit(const char *left, size_t leftCnt, const char *right, size_t rightCnt, size_t k);
+
+
+int startSortPool(void) {
+    long threadCnt = SORT_THREADS;
+
+    if (threadCnt <= 0)
+        threadCnt = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threadCnt < 1)
+        threadCnt = 1;
+    if (threadCnt > MAX_SORT_THREADS)
+        threadCnt = MAX_SORT_THREADS;
+
+    // Worker: 모든 Signal 막은 상태로 생성 (runner()와 같음, Signal은 Main Thread에서만 처리)
+    sigset_t sigmask, oldSigmask;
+    sigfillset(&sigmask);
+    pthread_sigmask(SIG_BLOCK, &sigmask, &oldSigmask);
+
+    pthread_mutex_lock(&poolMutex);
+    stopRequested = false;
+    for (totalWorkers = 0; totalWorkers < threadCnt - 1; totalWorkers++) {
+        if (pthread_create(&workers[totalWorkers], NULL, sortWorker, NULL) != 0)
+            break;  // 생성된 Worker 수만큼만 사용
+    }
+    pthread_sigmask(SIG_SETMASK, &oldSigmask, NULL);
+    isPoolStarted = true;
+    pthread_mutex_unlock(&poolMutex);
+    return totalWorkers + 1 == threadCnt ? 0 : -1;
+}
+
+void stopSortPool(void) {
+    pthread_mutex_lock(&poolMutex);  // 진행 중인 정렬 끝날 때까지 대기
+    pthread_mutex_lock(&taskMutex);
+    stopRequested = true;
+    pthread_cond_broadcast(&taskReady);
+    pthread_mutex_unlock(&taskMutex);
+
+    for (size_t i = 0; i < totalWorkers; i++)
+        pthread_join(workers[i], NULL);
+    totalWorkers = 0;
+    isPoolStarted = false;
+    pthread_mutex_unlock(&poolMutex);
+}
+
+void parallelSort(void *base, size_t itemCnt, size_t itemSize, int (*compare)(const void *, const void *, void *), void *arg) {
+    if (itemCnt < PARALLEL_SORT_MIN_ITEMS) {
+        qsort_r(base, itemCnt, itemSize, compare, arg);
+        return;
+    }
+    if (pthread_mutex_trylock(&poolMutex) != 0) {  // 다른 창이 Pool 사용 중: 기다리지 않고 직접 정렬
+        qsort_r(base, itemCnt, itemSize, compare, arg);
+        return;
+    }
+    char *tmpBuf;
+    if (!isPoolStarted || totalWorkers == 0 || (tmpBuf = malloc(itemCnt * itemSize)) == NULL) {
+        pthread_mutex_unlock(&poolMutex);
+        qsort_r(base, itemCnt, itemSize, compare, arg);
+        return;
+    }
+
+    size_t threadCnt = totalWorkers + 1;
+    size_t chunkCnt = threadCnt;
+    size_t runStarts[MAX_SORT_THREADS + 1];  // 각 정렬된 구간의 시작 Index (+ 끝)
+    char *src = base, *dst = tmpBuf;
+
+    curItemSize = itemSize;
+    curCompare = compare;
+    curArg = arg;
+
+    // 1단계: 구간별 병렬 정렬
+    for (size_t i = 0; i <= chunkCnt; i++)
+        runStarts[i] = itemCnt * i / chunkCnt;
+    for (size_t i = 0; i < chunkCnt; i++) {
+        tasks[i] = (SortTask) {
+            .src = src + runStarts[i] * itemSize,
+            .srcCnt = runStarts[i + 1] - runStarts[i],
+            .other = NULL
+        };
+    }
+    dispatchTasks(chunkCnt);
+
+    // 2단계: 두 구간씩 병합 반복 (src <-> dst 번갈아 사용)
+    size_t runCnt = chunkCnt;
+    while (runCnt > 1) {
+        size_t pairCnt = runCnt / 2;
+        size_t partsPerPair = threadCnt / pairCnt > 0 ? threadCnt / pairCnt : 1;  // 쌍 수가 적으면: 한 쌍을 여러 조각으로 나눔
+        size_t taskCnt = 0;
+
+        for (size_t pair = 0; pair < pairCnt; pair++) {
+            size_t leftStart = runStarts[pair * 2];
+            size_t rightStart = runStarts[pair * 2 + 1];
+            size_t end = runStarts[pair * 2 + 2];
+            char *left = src + leftStart * itemSize;
+            char *right = src + rightStart * itemSize;
+            size_t leftCnt = rightStart - leftStart;
+            size_t rightCnt = end - rightStart;
+            size_t prevK = 0, prevSplit = 0;
+
+            for (size_t part = 1; part <= partsPerPair; part++) {
+                size_t k = (leftCnt + rightCnt) * part / partsPerPair;
+                size_t split = part == partsPerPair ? leftCnt : findMergeSplit(left, leftCnt, right, rightCnt, k);
+
+                tasks[taskCnt++] = (SortTask) {
+                    .src = left + prevSplit * itemSize,
+                    .srcCnt = split - prevSplit,
+                    .other = right + (prevK - prevSplit) * itemSize,
+                    .otherCnt = (k - split) - (prevK - prevSplit),
+                    .dst = dst + (leftStart + prevK) * itemSize
+                };
+                prevK = k;
+                prevSplit = split;
+            }
+        }
+        if (runCnt % 2 == 1) {  // 짝이 없는 마지막 구간: 그대로 복사
+            size_t lastStart = runStarts[runCnt - 1];
+            tasks[taskCnt++] = (SortTask) {
+                .src = src + lastStart * itemSize,
+                .srcCnt = itemCnt - lastStart,
+                .other = src,  // 빈 구간과 병합 = 복사
+                .otherCnt = 0,
+                .dst = dst + lastStart * itemSize
+            };
+        }
+        dispatchTasks(taskCnt);
+
+        // 구간 경계 갱신: 두 구간 -> 하나
+        for (size_t i = 0; i < pairCnt; i++)
+            runStarts[i] = runStarts[i * 2];
+        if (runCnt % 2 == 1)
+            runStarts[pairCnt] = runStarts[runCnt - 1];
+        runCnt = (runCnt + 1) / 2;
+        runStarts[runCnt] = itemCnt;
+
+        char *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != (char *)base)  // 최종 결과가 임시 Buffer에 있는 경우
+        memcpy(base, src, itemCnt * itemSize);
+
+    pthread_mutex_unlock(&poolMutex);
+    free(tmpBuf);
+}
+
+void *sortWorker(void *arg) {
+    uint64_t seenGeneration = 0;
+
+    pthread_mutex_lock(&taskMutex);
+    while (true) {
+        while (!stopRequested && seenGeneration == taskGeneration)
+            pthread_cond_wait(&taskReady, &taskMutex);
+        if (stopRequested)
+            break;
+        seenGeneration = taskGeneration;
+        pthread_mutex_unlock(&taskMutex);
+        runPendingTasks();
+        pthread_mutex_lock(&taskMutex);
+    }
+    pthread_mutex_unlock(&taskMutex);
+    return NULL;
+}
+
+void runPendingTasks(void) {
+    size_t taskIdx;
+
+    while (true) {
+        pthread_mutex_lock(&taskMutex);
+        if (nextTask >= totalTasks) {
+            pthread_mutex_unlock(&taskMutex);
+            return;
+        }
+        taskIdx = nextTask++;
+        pthread_mutex_unlock(&taskMutex);
+
+        runTask(&tasks[taskIdx]);
+
+        pthread_mutex_lock(&taskMutex);
+        if (--pendingTasks == 0)
+            pthread_cond_signal(&taskDone);
+        pthread_mutex_unlock(&taskMutex);
+    }
+}
+
+void dispatchTasks(size_t taskCnt) {
+    pthread_mutex_lock(&taskMutex);
+    totalTasks = taskCnt;
+    nextTask = 0;
+    pendingTasks = taskCnt;
+    taskGeneration++;
+    pthread_cond_broadcast(&taskReady);
+    pthread_mutex_unlock(&taskMutex);
+
+    runPendingTasks();  // 호출한 Thread도 작업 수행
+
+    pthread_mutex_lock(&taskMutex);
+    while (pendingTasks > 0)
+        pthread_cond_wait(&taskDone, &taskMutex);
+    pthread_mutex_unlock(&taskMutex);
+}
+
+void runTask(const SortTask *task) {
+    if (task->other == NULL) {
+        qsort_r(task->src, task->srcCnt, curItemSize, curCompare, curArg);
+        return;
+    }
+
+    const char *left = task->src, *leftEnd = task->src + task->srcCnt * curItemSize;
+    const char *right = task->other, *rightEnd = task->other + task->otherCnt * curItemSize;
+    char *out = task->dst;
+
+    while (left < leftEnd && right < rightEnd) {
+        if (curCompare(right, left, curArg) < 0) {  // 같으면 앞 구간 우선 (안정 병합)
+            memcpy(out, right, curItemSize);
+            right += curItemSize;
+        } else {
+            memcpy(out, left, curItemSize);
+            left += curItemSize;
+        }
+        out += curItemSize;
+    }
+    // 남은 항목 복사
+    if (left < leftEnd) {
+        memcpy(out, left, leftEnd - left);
+        out += leftEnd - left;
+    }
+    if (right < rightEnd)
+        memcpy(out, right, rightEnd - right);
+}
+
+size_t findMergeSplit(const char *left, size_t leftCnt, const char *right, size_t rightCnt, size_t k) {
+    size_t low = k > rightCnt ? k - rightCnt : 0;
+    size_t high = k < leftCnt ? k : leftCnt;
+
+    // left[mid] <= right[k - mid - 1]: 앞 구간에서 더 가져와야 함
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (curCompare(left + mid * curItemSize, right + (k - mid - 1) * curItemSize, curArg) <= 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
@@ -0,0 +1,39 @@
+#ifndef _PARALLEL_SORT_H_INCLUDED_
+#define _PARALLEL_SORT_H_INCLUDED_
+
+#include <stddef.h>
+
+
+/**
+ * 병렬 정렬용 Worker Thread Pool 시작
+ *
+ * @return 성공: 0, 실패: -1 (실패 시: parallelSort()는 단일 Thread로 동작)
+ *
+ * @details
+ * - Thread 수: `SORT_THREADS` (0: 사용 가능한 CPU 수), 최대 `MAX_SORT_THREADS`
+ * - 호출한 Thread도 정렬에 참여 -> (Thread 수 - 1)개의 Worker 생성
+ */
+int startSortPool(void);
+
+/**
+ * 병렬 정렬용 Worker Thread Pool 정지 (모든 Worker 종료 대기)
+ */
+void stopSortPool(void);
+
+/**
+ * 배열 정렬 (qsort_r과 같은 형식): 큰 배열은 여러 Thread로 나누어 정렬
+ *
+ * @param base 정렬할 배열
+ * @param itemCnt 항목 수
+ * @param itemSize 항목 1개의 크기
+ * @param compare 비교 함수 (qsort_r 참조)
+ * @param arg 비교 함수에 전달할 인자
+ *
+ * @details
+ * - `PARALLEL_SORT_MIN_ITEMS`개 미만, Pool 미시작, Pool 사용 중 (다른 창이 정렬 중), 임시 메모리 할당 실패: qsort_r()로 정렬
+ * - 그 외: 구간별로 나누어 병렬 정렬 -> 두 구간씩 병렬 병합 반복
+ * - 병합: 출력 위치 기준으로 잘라 (merge path) 한 쌍의 병합도 여러 Thread가 나누어 수행
+ */
+void parallelSort(void *base, size_t itemCnt, size_t itemSize, int (*compare)(const void *, const void *, void *), void *arg);
+
+#endif
@@ -10,6 +10,7 @@
 #include "colors.h"
 #include "commons.h"
 #include "config.h"
+#include "cursor_event.h"
 #include "list_process.h"
 #include "process_window.h"
 
@@ -20,7 +21,7 @@ static pthread_mutex_t *bufMutex;
 static size_t *totalReadItems;
 static Process *processes;
 
-static uint64_t lineMovementEvent = 0;  // 커서 이동 이벤트 저장
+static CursorEventQueue cursorEvents;  // 커서 이동 이벤트 저장
 static size_t currentPos = 0;
 
 
@@ -224,17 +225,11 @@ void printProcessInfo(WINDOW *win, int winW, Process process, int line) {
 }
 
 void selectPreviousProcess() {
-    // 이미 공간 다 썼다면 (= MSB가 1) -> 이후 수신된 이벤트 버림
-    if (lineMovementEvent & (UINT64_C(0x80) << (7 * 8)))
-        return;
-    lineMovementEvent = lineMovementEvent << 2 | 0x02;  // <한 칸 위로> Event 저장
+    pushCursorEvent(&cursorEvents, CURSOR_UP, 0);  // <한 칸 위로> Event 저장
 }
 
 void selectNextProcess() {
-    // 이미 공간 다 썼다면 (= MSB가 1) -> 이후 수신된 이벤트 버림
-    if (lineMovementEvent & (UINT64_C(0x80) << (7 * 8)))
-        return;
-    lineMovementEvent = lineMovementEvent << 2 | 0x03;  // <한 칸 아래로> Event 저장
+    pushCursorEvent(&cursorEvents, CURSOR_DOWN, 0);  // <한 칸 아래로> Event 저장
 }
 
 void getSelectedProcess(pid_t *pid, char *nameBuf, size_t bufLen) {
@@ -248,30 +243,8 @@ void getSelectedProcess(pid_t *pid, char *nameBuf, size_t bufLen) {
 }
 
 void processLineMovementEvent(void) {
-    size_t itemsCnt = *totalReadItems;  // 읽어들인 총 항목 수
-
-    int eventStartPos;
-    int lineMovement;
-    for (eventStartPos = 0; (lineMovementEvent & (UINT64_C(2) << eventStartPos)) != 0; eventStartPos += 2);
-    while (eventStartPos > 0) {
-        eventStartPos -= 2;
-        lineMovement = (lineMovementEvent >> eventStartPos) & 0x03;
-        switch (lineMovement) {
-            case 0x02:  // '한 칸 위로 이동' Event
-                if (currentPos > 0)  // 위로 이동 가능하면
-                    currentPos--;
-                else
-                    currentPos = 0;  // Corner case 처리: 최소 Index
-                break;
-            case 0x03:  // '한 칸 아래로 이동' Event
-                if (currentPos < itemsCnt - 1)  // 아래로 이동 가능하면
-                    currentPos++;
-                else
-                    currentPos = itemsCnt - 1;  // Corner case 처리: 최대 Index
-                break;
-        }
-    }
-    lineMovementEvent = 0;  // 이벤트 초기화
+    CursorMove move = drainCursorEvents(&cursorEvents);
+    currentPos = applyCursorMove(&move, currentPos, *totalReadItems, getmaxy(window) - 3, currentPos);
 }
 
 
@@ -0,0 +1,164 @@
+#include <curses.h>
+#include <panel.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "colors.h"
+#include "commons.h"
+#include "config.h"
+#include "stats_window.h"
+#include "thread_commons.h"
+
+#define STATS_WIN_W 112  // 통계 창 최대 폭
+#define MAX_STATS_THREADS (MAX_DIRWINS + MAX_FILE_OPERATORS + 1)  // 등록 가능한 Thread 수 (Listener + File Operator + Process)
+#define STATS_ROW_LEN 256  // 표 1줄의 최대 길이 (값이 아주 큰 경우 포함)
+
+#define STATS_HEADER "THREAD        RUNS       ERR      p50      p99      MAX  JIT avg  JIT max   SKIP  LOCK n LOCK sum LOCK max"
+
+
+/**
+ * @struct _StatsThread
+ *
+ * @var _StatsThread::name 표시 이름
+ * @var _StatsThread::threadArgs 대상 Thread의 ThreadArgs 구조체
+ */
+typedef struct _StatsThread {
+    const char *name;  // 표시 이름
+    ThreadArgs *threadArgs;  // 대상 Thread의 ThreadArgs 구조체
+} StatsThread;
+
+
+static WINDOW *statsWindow;
+static PANEL *statsPanel;
+static bool isStatsShown;
+
+static StatsThread threads[MAX_STATS_THREADS];  // 등록된 Thread들
+static int threadCnt;
+
+
+/**
+ * Thread 1개의 통계를 표 1줄로 변환 (STATS_HEADER와 같은 열 구성)
+ *
+ * @param thread 대상 Thread
+ * @param buf (반환) 표 1줄 (최소 STATS_ROW_LEN bytes)
+ */
+static void formatStatsRow(const StatsThread *thread, char *buf);
+
+
+void initStatsWindow(void) {
+    statsWindow = newwin(MAX_STATS_THREADS + 3, STATS_WIN_W, 0, 0);
+    if (statsWindow == NULL) {
+        return;
+    }
+    if (isColorSafe) {
+        wbkgd(statsWindow, COLOR_PAIR(POPUP));
+    }
+    statsPanel = new_panel(statsWindow);
+    hide_panel(statsPanel);
+}
+
+void delStatsWindow(void) {
+    if (statsWindow == NULL)
+        return;
+    del_panel(statsPanel);
+    delwin(statsWindow);
+}
+
+int addStatsThread(const char *name, ThreadArgs *threadArgs) {
+    if (threadCnt >= MAX_STATS_THREADS)
+        return -1;
+    threads[threadCnt].name = name;
+    threads[threadCnt].threadArgs = threadArgs;
+    threadCnt++;
+    return 0;
+}
+
+void toggleStatsWindow(void) {
+    if (statsWindow == NULL)
+        return;
+    isStatsShown = !isStatsShown;
+    if (isStatsShown) {
+        show_panel(statsPanel);
+    } else {
+        hide_panel(statsPanel);
+    }
+}
+
+void updateStatsWindow(void) {
+    char row[STATS_ROW_LEN];
+
+    if (!isStatsShown)
+        return;
+
+    // 창 크기 바뀌었을 수 있음: 화면 가운데에 맞춤
+    int winH = threadCnt + 3 < LINES ? threadCnt + 3 : LINES;
+    int winW = STATS_WIN_W < COLS ? STATS_WIN_W : COLS;
+    wresize(statsWindow, winH, winW);
+    move_panel(statsPanel, (LINES - winH) / 2, (COLS - winW) / 2);
+
+    werase(statsWindow);
+    box(statsWindow, 0, 0);
+    mvwaddnstr(statsWindow, 0, 2, " Thread stats ", winW - 4);
+    mvwaddnstr(statsWindow, 1, 1, STATS_HEADER, winW - 2);
+    for (int i = 0; i < threadCnt && i + 2 < winH - 1; i++) {
+        formatStatsRow(&threads[i], row);
+        mvwaddnstr(statsWindow, i + 2, 1, row, winW - 2);
+    }
+}
+
+int dumpThreadStats(const char *path) {
+    char row[STATS_ROW_LEN];
+    ThreadStats stats;
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+        return -1;
+
+    fprintf(file, "%s\n", STATS_HEADER);
+    for (int i = 0; i < threadCnt; i++) {
+        formatStatsRow(&threads[i], row);
+        fprintf(file, "%s\n", row);
+    }
+
+    // 실행 시간 분포: 간격 조정용 ("<상한: 횟수", 구간 i: [2^i, 2^(i+1)) μs)
+    fprintf(file, "\nrun time histogram (<upper bound: count)\n");
+    for (int i = 0; i < threadCnt; i++) {
+        getThreadStats(threads[i].threadArgs, &stats);
+        fprintf(file, "%-10s", threads[i].name);
+        for (int j = 0; j < THREAD_STATS_HIST_BUCKETS; j++) {
+            if (stats.sched.runHist[j] == 0)
+                continue;
+            formatUSec(2ULL << j, row, sizeof(row));
+            fprintf(file, " <%s: %u", row, stats.sched.runHist[j]);
+        }
+        fprintf(file, "\n");
+    }
+
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+void formatStatsRow(const StatsThread *thread, char *buf) {
+    ThreadStats stats;
+    char errors[48], p50[24], p99[24], maxRun[24], jitterAvg[24], jitterMax[24], lockSum[24], lockMax[24];
+
+    getThreadStats(thread->threadArgs, &stats);
+
+    if (stats.sched.errors == 0)
+        sprintf(errors, "0");
+    else
+        sprintf(errors, "%llu/e%d", (unsigned long long)stats.sched.errors, stats.sched.lastError);  // 횟수/마지막 errno
+    formatUSec(getRunTimePercentile(&stats.sched, 50), p50, sizeof(p50));
+    formatUSec(getRunTimePercentile(&stats.sched, 99), p99, sizeof(p99));
+    formatUSec(stats.sched.maxRunUSec, maxRun, sizeof(maxRun));
+    formatUSec(stats.sched.scheduledRuns ? stats.sched.totalJitterUSec / stats.sched.scheduledRuns : 0, jitterAvg, sizeof(jitterAvg));
+    formatUSec(stats.sched.maxJitterUSec, jitterMax, sizeof(jitterMax));
+    formatUSec(stats.lockWaitUSec, lockSum, sizeof(lockSum));
+    formatUSec(stats.maxLockWaitUSec, lockMax, sizeof(lockMax));
+
+    snprintf(
+        buf, STATS_ROW_LEN, "%-10.10s %7llu %9s %8s %8s %8s %8s %8s %6llu %7llu %8s %8s",
+        thread->name, (unsigned long long)stats.sched.iterations, errors, p50, p99, maxRun,
+        jitterAvg, jitterMax, (unsigned long long)stats.sched.skippedRuns,
+        (unsigned long long)stats.lockWaits, lockSum, lockMax
+    );
+}
@@ -0,0 +1,48 @@
+#ifndef _STATS_WINDOW_H_INCLUDED_
+#define _STATS_WINDOW_H_INCLUDED_
+
+#include "thread_commons.h"
+
+
+/**
+ * Thread 통계 창 초기화 (숨겨진 상태로 생성)
+ */
+void initStatsWindow(void);
+
+/**
+ * Thread 통계 창 자원 해제
+ */
+void delStatsWindow(void);
+
+/**
+ * 통계를 표시할 Thread 등록 (Thread 시작 전, 표시 순서대로 호출)
+ *
+ * @param name 표시 이름 (주의: 프로그램 종료 시까지 유지되는 문자열)
+ * @param threadArgs 대상 Thread의 ThreadArgs 구조체
+ * @return 성공: 0, 등록 가능한 수 초과: -1
+ */
+int addStatsThread(const char *name, ThreadArgs *threadArgs);
+
+/**
+ * Thread 통계 창 표시/숨김 전환
+ */
+void toggleStatsWindow(void);
+
+/**
+ * 표시 중이면 통계 다시 읽어 갱신 (매 Frame 호출)
+ *
+ * @details
+ * - 열: 실행 횟수, 실패 횟수 (마지막 errno), 1회 실행 시간 p50/p99/최대, Jitter 평균/최대, 건너뛴 주기, Mutex 대기 횟수/합계/최대
+ * - File Operator: 1회 실행 = 작업 요청 대기 + 작업 -> 실행 시간에 대기 시간 포함
+ */
+void updateStatsWindow(void);
+
+/**
+ * 등록된 Thread들의 통계를 파일로 저장 (표 + 실행 시간 Histogram)
+ *
+ * @param path 저장할 파일 경로 (덮어씀)
+ * @return 성공: 0, 실패: -1
+ */
+int dumpThreadStats(const char *path);
+
+#endif
@@ -5,16 +5,21 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
 
 #include "commons.h"
 #include "thread_commons.h"
 
 
+static int uiNotifyFd = -1;  // 화면 갱신 알림용 eventfd
+static __thread ThreadArgs *currentThreadArgs;  // 현재 Thread의 ThreadArgs (runner()가 설정, Main Thread 등: NULL)
+static uint32_t uiWakeSources;  // 알림된 종류들 (UI_WAKE_*): Atomic하게 접근
+
+
 typedef struct _RunnerArgument {
     int (*onInit)(void *);
-    int (*loop)(void *);
     int (*onFinish)(void *);
-    uint64_t loopInterval;
     ThreadArgs *threadArgs;
     void *targetFuncArgs;
 } RunnerArgument;
@@ -28,14 +33,45 @@ typedef struct _RunnerArgument {
  */
 static void *runner(void *runnerArgument);
 
+/**
+ * 실행 끝난 작업의 다음 실행 시간 계산, 통계 갱신 (statusMutex 획득한 상태에서 호출)
+ *
+ * @param task 실행 끝난 작업
+ * @param startUSec 실행 시작 시간
+ * @param endUSec 실행 끝난 시간
+ */
+static void scheduleNextRun(PeriodicTask *task, uint64_t startUSec, uint64_t endUSec);
+
+/**
+ * 실행 시간이 속하는 Histogram 구간 계산
+ *
+ * @param usec 실행 시간 [단위: μs]
+ * @return 구간 번호 ( [0, THREAD_STATS_HIST_BUCKETS) )
+ */
+static inline unsigned int getHistBucket(uint64_t usec);
+
 /**
  * 깨어날 시간 계산
  *
- * @param wakeupUs 대기 시간
- * @return 깨어날 시간 (Clock: CLOCK_REALTIME 기준)
+ * @param wakeupUSec 깨어날 시간 (getMonotonicUSec() 기준)
+ * @return 깨어날 시간 (Clock: CLOCK_MONOTONIC 기준, pthread_cond_timedwait()에 전달)
  */
-static struct timespec getWakeupTime(uint32_t wakeupUs);
+static struct timespec getWakeupTime(uint64_t wakeupUSec);
+
+
+int initThreadArgs(ThreadArgs *threadArgs) {
+    pthread_condattr_t condAttr;
+    int ret;
 
+    if ((ret = pthread_mutex_init(&threadArgs->statusMutex, NULL)) != 0)
+        return ret;
+    if ((ret = pthread_condattr_init(&condAttr)) != 0)
+        return ret;
+    if ((ret = pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC)) == 0)  // 대기 시간: 시스템 시간 변경 (NTP 등) 영향 X
+        ret = pthread_cond_init(&threadArgs->resumeThread, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+    return ret;
+}
 
 int startThread(
     pthread_t *newThread,
@@ -45,14 +81,35 @@ int startThread(
     uint64_t loopInterval,
     ThreadArgs *threadArgs,
     void *targetFuncArgs
+) {
+    // Thread 시작 전: Mutex 불필요 (mode: 호출한 쪽에서 미리 설정 가능)
+    threadArgs->mainTask.loop = loop;
+    threadArgs->mainTask.args = targetFuncArgs;
+    threadArgs->mainTask.interval = loopInterval;
+    return startTaskThread(newThread, onInit, onFinish, &threadArgs->mainTask, 1, threadArgs, targetFuncArgs);
+}
+
+int startTaskThread(
+    pthread_t *newThread,
+    int (*onInit)(void *),
+    int (*onFinish)(void *),
+    PeriodicTask *tasks,
+    size_t taskCnt,
+    ThreadArgs *threadArgs,
+    void *targetFuncArgs
 ) {
     RunnerArgument *argument = malloc(sizeof(RunnerArgument));
     assert(argument != NULL);
 
+    for (size_t i = 0; i < taskCnt; i++) {
+        assert(tasks[i].loop != NULL);
+        tasks[i].nextRunUSec = 0;  // 시작하자마자 실행
+    }
+    threadArgs->tasks = tasks;
+    threadArgs->taskCnt = taskCnt;
+
     argument->onInit = onInit;
-    argument->loop = loop;
     argument->onFinish = onFinish;
-    argument->loopInterval = loopInterval;
     argument->threadArgs = threadArgs;
     argument->targetFuncArgs = targetFuncArgs;
 
@@ -67,14 +124,14 @@ void *runner(void *runnerArgument) {
     RunnerArgument *argument = (RunnerArgument *)runnerArgument;  // Cast
     // Thread의 runtime information 저장
     int (*onInit)(void *) = argument->onInit;
-    int (*loop)(void *) = argument->loop;
     int (*onFinish)(void *) = argument->onFinish;
-    uint64_t loopInterval = argument->loopInterval;
     ThreadArgs *threadArgs = argument->threadArgs;
     void *targetFuncArgs = argument->targetFuncArgs;
     free(runnerArgument);  // 메모리 해제
+    currentThreadArgs = threadArgs;  // lockMutex()의 대기 시간 기록 대상
 
-    assert(loop != NULL);
+    PeriodicTask *tasks = threadArgs->tasks;
+    size_t taskCnt = threadArgs->taskCnt;
 
     // (필요하면) onInit 함수 호출
     if (onInit != NULL)
@@ -83,27 +140,43 @@ void *runner(void *runnerArgument) {
     // 'Thread 작동 중' Flag 설정
     pthread_mutex_lock(&threadArgs->statusMutex);  // 상태 보호 Mutex 획득
     threadArgs->statusFlags |= THREAD_FLAG_RUNNING;
-    pthread_mutex_unlock(&threadArgs->statusMutex);  // 상태 보호 Mutex 해제
 
-    // Main Loop
-    struct timespec startTime;  // Loop 시작 시간
+    // Main Loop (주의: 상태 보호 Mutex 획득된 상태로 반복, 작업 함수 실행 중에만 해제)
     struct timespec wakeupTime;  // 다시 깨어날 시간
-    uint64_t elapsedUSec;  // 이 Iteration에서 흐른 시간 [단위: μs]
+    uint64_t startUSec;  // 작업 시작 시간
+    uint64_t wakeupUSec;  // 가장 빠른 다음 실행 예정 시간
+    uint64_t endUSec;  // 작업 끝난 시간
+    int loopErrno;  // 작업 실패 시의 errno
     int ret;  // 각종 함수 Return값 (임시 변수)
     while (1) {
-        CHECK_FAIL(clock_gettime(CLOCK_REALTIME, &startTime));  // iteration 시작 시간 저장
+        // 예정 시간 된 작업들 실행
+        for (size_t i = 0; i < taskCnt; i++) {
+            // 작업 실행 전 정지 요청 확인
+            if (threadArgs->statusFlags & THREAD_FLAG_STOP)  // 종료 요청되었으면: 중지
+                goto EXIT_LOOP;
 
-        // loop 함수 실행 전 정지 요청 확인
-        pthread_mutex_lock(&threadArgs->statusMutex);  // 상태 Flag 보호 Mutex 획득
-        if (threadArgs->statusFlags & THREAD_FLAG_STOP) {  // 종료 요청되었으면: 중지
-            goto EXIT_LOOP;
-        }
-        pthread_mutex_unlock(&threadArgs->statusMutex);  // 상태 Flag 보호 Mutex 해제
+            startUSec = getMonotonicUSec();
+            if (tasks[i].nextRunUSec > startUSec)  // 아직 예정 시간 아님
+                continue;
 
-        loop(targetFuncArgs);  // Thread loop 함수 호출
+            pthread_mutex_unlock(&threadArgs->statusMutex);  // 상태 보호 Mutex 해제
+            ret = tasks[i].loop(tasks[i].args);  // 작업 함수 호출
+            loopErrno = errno;
+            endUSec = getMonotonicUSec();
+            lockMutex(&threadArgs->statusMutex);  // 상태 보호 Mutex 획득
 
-        // 설정된 간격만큼 지연 및 종료 요청 처리
-        pthread_mutex_lock(&threadArgs->statusMutex);  // 상태 보호 Mutex 획득
+            // 실행 통계 기록
+            tasks[i].stats.iterations++;
+            tasks[i].stats.runHist[getHistBucket(endUSec - startUSec)]++;
+            tasks[i].stats.totalRunUSec += endUSec - startUSec;
+            if (endUSec - startUSec > tasks[i].stats.maxRunUSec)
+                tasks[i].stats.maxRunUSec = endUSec - startUSec;
+            if (ret < 0) {
+                tasks[i].stats.errors++;
+                tasks[i].stats.lastError = loopErrno;
+            }
+            scheduleNextRun(&tasks[i], startUSec, endUSec);
+        }
 
         // 대기 진입 전 종료 확인
         if (threadArgs->statusFlags & THREAD_FLAG_STOP) {  // 종료 요청되었으면: 중지
@@ -115,21 +188,27 @@ void *runner(void *runnerArgument) {
             threadArgs->statusFlags &= ~THREAD_FLAG_PAUSE;  // 일시정지 요청 '소비'
             ret = pthread_cond_wait(&threadArgs->resumeThread, &threadArgs->statusMutex);  // 다음 요청시까지 대기
         } else {
-            elapsedUSec = getElapsedTime(startTime);  // 실제 지연 시간 계산
-            if (elapsedUSec > loopInterval) {  // 지연 필요하면
-                wakeupTime = getWakeupTime(loopInterval - elapsedUSec);  // 재개할 '절대 시간' 계산
-                ret = pthread_cond_timedwait(&threadArgs->resumeThread, &threadArgs->statusMutex, &wakeupTime);  // 다음 Delay까지 재개 요청 기다리며 대기
-            } else {  // 지연 필요없음 (직전 iteration이 너무 오래 걸림)
+            // 가장 빠른 예정 시간까지 대기
+            wakeupUSec = UINT64_MAX;
+            for (size_t i = 0; i < taskCnt; i++)
+                if (tasks[i].nextRunUSec < wakeupUSec)
+                    wakeupUSec = tasks[i].nextRunUSec;
+            if (wakeupUSec > getMonotonicUSec()) {  // 지연 필요하면
+                wakeupTime = getWakeupTime(wakeupUSec);  // 재개할 '절대 시간' 계산
+                ret = pthread_cond_timedwait(&threadArgs->resumeThread, &threadArgs->statusMutex, &wakeupTime);  // 다음 예정 시간까지 재개 요청 기다리며 대기
+            } else {  // 지연 필요없음 (작업들이 너무 오래 걸림)
                 ret = ETIMEDOUT;  // 지연 끝난 것처럼 처리
             }
         }
 
         // 주의: 현재 statusMutex 획득된 상태 -> 코드 작성 시 유의
         switch (ret) {
-            case 0:  // 재개 요청됨
+            case 0:  // 재개 요청됨: 모든 작업 바로 실행
+                for (size_t i = 0; i < taskCnt; i++)
+                    tasks[i].nextRunUSec = 0;
+                break;
             case ETIMEDOUT:  // 대기 완료
             case EINTR:  // 대기 중 Interrupt 발생
-                pthread_mutex_unlock(&threadArgs->statusMutex);  // 상태 보호 Mutex 해제
                 break;  // 실행 재개
             default:
                 goto HALT;  // 오류: 쓰레드 정지
@@ -192,11 +271,132 @@ int resumeThread(ThreadArgs *args) {
     return 0;
 }
 
-struct timespec getWakeupTime(uint32_t wakeupUs) {
+void scheduleNextRun(PeriodicTask *task, uint64_t startUSec, uint64_t endUSec) {
+    uint64_t jitterUSec;
+
+    if (task->nextRunUSec != 0) {  // 예정 시간에 맞춘 실행: Jitter 기록 (재개 요청으로 바로 실행된 경우 제외)
+        jitterUSec = startUSec - task->nextRunUSec;
+        task->stats.scheduledRuns++;
+        task->stats.lastJitterUSec = jitterUSec;
+        task->stats.totalJitterUSec += jitterUSec;
+        if (jitterUSec > task->stats.maxJitterUSec)
+            task->stats.maxJitterUSec = jitterUSec;
+    }
+
+    if (task->interval == 0) {  // 간격 없음: 바로 다시 실행
+        task->nextRunUSec = endUSec;
+    } else if (task->mode == THREAD_SCHED_FIXED_DELAY) {  // 끝난 시간 기준
+        task->nextRunUSec = endUSec + task->interval;
+    } else if (task->nextRunUSec == 0) {  // Fixed-rate, 바로 실행된 경우: 이번 시작 시간부터 다시 기준 잡음
+        task->nextRunUSec = startUSec + task->interval;
+    } else {  // 이전 예정 시간 기준: 누적 오차 없음
+        task->nextRunUSec += task->interval;
+        if (task->nextRunUSec <= endUSec) {  // 실행이 길어져 다음 예정 시간 지남: 밀린 주기 건너뜀 (몰아서 실행 X)
+            uint64_t missed = (endUSec - task->nextRunUSec) / task->interval + 1;
+            task->nextRunUSec += missed * task->interval;
+            task->stats.skippedRuns += missed;
+        }
+    }
+}
+
+unsigned int getHistBucket(uint64_t usec) {
+    unsigned int bucket = usec < 2 ? 0 : 63 - __builtin_clzll(usec);  // floor(log2(usec))
+    return bucket < THREAD_STATS_HIST_BUCKETS ? bucket : THREAD_STATS_HIST_BUCKETS - 1;
+}
+
+int lockMutex(pthread_mutex_t *mutex) {
+    ThreadArgs *threadArgs = currentThreadArgs;
+    uint64_t startUSec, waitUSec, maxUSec;
+    int ret;
+
+    if (threadArgs == NULL)
+        return pthread_mutex_lock(mutex);
+    if ((ret = pthread_mutex_trylock(mutex)) != EBUSY)  // 바로 획득 (or 오류)
+        return ret;
+
+    startUSec = getMonotonicUSec();
+    if ((ret = pthread_mutex_lock(mutex)) != 0)
+        return ret;
+    waitUSec = getMonotonicUSec() - startUSec;
+
+    // 자신만 증가시킴 -> 다른 Thread가 읽는 중 값이 찢어지지 않도록 Atomic 접근만 하면 됨
+    __atomic_add_fetch(&threadArgs->lockWaits, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&threadArgs->lockWaitUSec, waitUSec, __ATOMIC_RELAXED);
+    maxUSec = __atomic_load_n(&threadArgs->maxLockWaitUSec, __ATOMIC_RELAXED);
+    if (waitUSec > maxUSec)
+        __atomic_store_n(&threadArgs->maxLockWaitUSec, waitUSec, __ATOMIC_RELAXED);
+    return 0;
+}
+
+void getThreadStats(ThreadArgs *threadArgs, ThreadStats *stats) {
+    ThreadSchedStats *sum = &stats->sched;
+    const ThreadSchedStats *task;
+
+    *stats = (ThreadStats) { 0 };
+    pthread_mutex_lock(&threadArgs->statusMutex);
+    for (size_t i = 0; i < threadArgs->taskCnt; i++) {
+        task = &threadArgs->tasks[i].stats;
+        sum->iterations += task->iterations;
+        for (int j = 0; j < THREAD_STATS_HIST_BUCKETS; j++)
+            sum->runHist[j] += task->runHist[j];
+        sum->totalRunUSec += task->totalRunUSec;
+        if (task->maxRunUSec > sum->maxRunUSec)
+            sum->maxRunUSec = task->maxRunUSec;
+        sum->scheduledRuns += task->scheduledRuns;
+        sum->lastJitterUSec = task->lastJitterUSec;
+        sum->totalJitterUSec += task->totalJitterUSec;
+        if (task->maxJitterUSec > sum->maxJitterUSec)
+            sum->maxJitterUSec = task->maxJitterUSec;
+        sum->skippedRuns += task->skippedRuns;
+        sum->errors += task->errors;
+        if (task->lastError != 0)
+            sum->lastError = task->lastError;
+    }
+    pthread_mutex_unlock(&threadArgs->statusMutex);
+
+    stats->lockWaits = __atomic_load_n(&threadArgs->lockWaits, __ATOMIC_RELAXED);
+    stats->lockWaitUSec = __atomic_load_n(&threadArgs->lockWaitUSec, __ATOMIC_RELAXED);
+    stats->maxLockWaitUSec = __atomic_load_n(&threadArgs->maxLockWaitUSec, __ATOMIC_RELAXED);
+}
+
+uint64_t getRunTimePercentile(const ThreadSchedStats *stats, unsigned int percentile) {
+    uint64_t target, seen = 0, upperUSec;
+
+    if (stats->iterations == 0)
+        return 0;
+    target = (stats->iterations * percentile + 99) / 100;  // 올림: 최소 1번째 값
+    for (int i = 0; i < THREAD_STATS_HIST_BUCKETS; i++) {
+        seen += stats->runHist[i];
+        if (seen >= target) {
+            upperUSec = (2ULL << i) - 1;  // 구간 상한
+            return i == THREAD_STATS_HIST_BUCKETS - 1 || upperUSec > stats->maxRunUSec ? stats->maxRunUSec : upperUSec;
+        }
+    }
+    return stats->maxRunUSec;
+}
+
+struct timespec getWakeupTime(uint64_t wakeupUSec) {
     struct timespec time;
-    CHECK_FAIL(clock_gettime(CLOCK_REALTIME, &time));  // 현재 시간 가져옴
-    uint64_t newNsec = time.tv_nsec + wakeupUs * 1000;  // 현재 시간 + 지연 시간 계산
-    time.tv_sec += newNsec / (1000 * 1000 * 1000);  // 깨어날 초 설정
-    time.tv_nsec = newNsec % (1000 * 1000 * 1000);  // 깨어날 나노초 설정
+    wakeupUSec -= 1;  // getMonotonicUSec(): 실제 시간 + 1
+    time.tv_sec = wakeupUSec / (1000 * 1000);  // 깨어날 초 설정
+    time.tv_nsec = (wakeupUSec % (1000 * 1000)) * 1000;  // 깨어날 나노초 설정
     return time;
 }
+
+int initUiNotifier(void) {
+    uiNotifyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    return uiNotifyFd;
+}
+
+void notifyUi(uint32_t source) {
+    uint64_t one = 1;
+    __atomic_fetch_or(&uiWakeSources, source, __ATOMIC_RELEASE);  // 종류 먼저 기록 -> eventfd로 깨움
+    if (uiNotifyFd != -1)
+        write(uiNotifyFd, &one, sizeof(one));  // 실패 (Counter 가득 참): 이미 알림 쌓인 상태 -> 무시
+}
+
+uint32_t clearUiNotification(void) {
+    uint64_t cnt;
+    read(uiNotifyFd, &cnt, sizeof(cnt));  // Non-blocking: 알림 없으면 바로 반환
+    return __atomic_exchange_n(&uiWakeSources, 0, __ATOMIC_ACQUIRE);
+}
@@ -2,6 +2,7 @@
 #define _THREAD_COMMONS_H_INCLUDED_
 
 #include <pthread.h>
+#include <stddef.h>
 #include <stdint.h>
 
 
@@ -10,21 +11,126 @@
 #define THREAD_FLAG_PAUSE (1 << 2)  // Thread 일시정지 요청
 #define THREAD_FLAG_MSB 2  // thread_commons에서 사용하는 가장 큰 bit
 
+// 화면 갱신 알림 종류 (notifyUi)
+#define UI_WAKE_DATA (1 << 0)  // 새 목록, 작업 결과 등 게시
+#define UI_WAKE_PROGRESS (1 << 1)  // 진행률만 변경
+// Main Thread 내부에서만 사용하는 종류 (Thread가 알리지 않음)
+#define UI_WAKE_KEY (1 << 2)  // 키 입력
+#define UI_WAKE_RESIZE (1 << 3)  // 창 크기 변경
+#define UI_WAKE_TIMER (1 << 4)  // 시계, 하단 메시지 만료
+
+// 주기 작업의 다음 실행 시간 기준
+#define THREAD_SCHED_FIXED_RATE 0  // 이전 '예정' 시간 + 간격 (밀린 주기는 건너뜀)
+#define THREAD_SCHED_FIXED_DELAY 1  // 이전 실행 '끝난' 시간 + 간격
+
+#define THREAD_STATS_HIST_BUCKETS 32  // 실행 시간 Histogram 구간 수 (구간 i: [2^i, 2^(i+1)) μs, 구간 0: [0, 2) μs)
+
+
+/**
+ * @struct _ThreadSchedStats
+ * 주기 작업의 실행 시간 통계 (Jitter: 예정 시간보다 늦게 시작한 정도)
+ *
+ * @var _ThreadSchedStats::iterations 실행 횟수
+ * @var _ThreadSchedStats::runHist 1회 실행 시간 Histogram (THREAD_STATS_HIST_BUCKETS 참조)
+ * @var _ThreadSchedStats::totalRunUSec 실행 시간 합계 [단위: μs]
+ * @var _ThreadSchedStats::maxRunUSec 최대 실행 시간 [단위: μs]
+ * @var _ThreadSchedStats::scheduledRuns 예정 시간에 맞춰 실행된 횟수 (재개 요청으로 바로 실행된 경우 제외)
+ * @var _ThreadSchedStats::lastJitterUSec 마지막 실행의 Jitter [단위: μs]
+ * @var _ThreadSchedStats::maxJitterUSec 최대 Jitter [단위: μs]
+ * @var _ThreadSchedStats::totalJitterUSec Jitter 합계 (평균: totalJitterUSec / scheduledRuns) [단위: μs]
+ * @var _ThreadSchedStats::skippedRuns 이전 실행이 길어져 건너뛴 주기 수 (THREAD_SCHED_FIXED_RATE)
+ * @var _ThreadSchedStats::errors 실패 (loop 함수가 음수 반환) 횟수
+ * @var _ThreadSchedStats::lastError 마지막 실패 시의 errno (0: 실패 없음)
+ */
+typedef struct _ThreadSchedStats {
+    uint64_t iterations;  // 실행 횟수
+    uint32_t runHist[THREAD_STATS_HIST_BUCKETS];  // 1회 실행 시간 Histogram
+    uint64_t totalRunUSec;  // 실행 시간 합계
+    uint64_t maxRunUSec;  // 최대 실행 시간
+    uint64_t scheduledRuns;  // 예정 시간에 맞춰 실행된 횟수
+    uint64_t lastJitterUSec;  // 마지막 실행의 Jitter
+    uint64_t maxJitterUSec;  // 최대 Jitter
+    uint64_t totalJitterUSec;  // Jitter 합계
+    uint64_t skippedRuns;  // 건너뛴 주기 수
+    uint64_t errors;  // 실패 횟수
+    int lastError;  // 마지막 실패 시의 errno
+} ThreadSchedStats;
+
+/**
+ * @struct _ThreadStats
+ * Thread 1개의 통계 (getThreadStats()로 복사한 값)
+ *
+ * @var _ThreadStats::sched 모든 작업의 실행 시간 통계 합계
+ * @var _ThreadStats::lockWaits Mutex 획득 대기한 횟수 (lockMutex()로 획득한 경우만)
+ * @var _ThreadStats::lockWaitUSec Mutex 획득 대기 시간 합계 [단위: μs]
+ * @var _ThreadStats::maxLockWaitUSec 최대 Mutex 획득 대기 시간 [단위: μs]
+ */
+typedef struct _ThreadStats {
+    ThreadSchedStats sched;  // 모든 작업의 실행 시간 통계 합계
+    uint64_t lockWaits;  // Mutex 획득 대기한 횟수
+    uint64_t lockWaitUSec;  // Mutex 획득 대기 시간 합계
+    uint64_t maxLockWaitUSec;  // 최대 Mutex 획득 대기 시간
+} ThreadStats;
+
+/**
+ * @struct _PeriodicTask
+ * Thread가 주기적으로 실행할 작업 1개
+ *
+ * @var _PeriodicTask::loop 실행할 함수
+ * @var _PeriodicTask::args loop 함수에 전달할 인자
+ * @var _PeriodicTask::interval 실행 간격 [단위: μs] (statusMutex로 보호, 실행 중 변경 가능: 다음 실행 시간 계산부터 적용)
+ * @var _PeriodicTask::mode 다음 실행 시간 기준 (THREAD_SCHED_*) (statusMutex로 보호)
+ * @var _PeriodicTask::stats 실행 시간 통계 (statusMutex로 보호)
+ * @var _PeriodicTask::nextRunUSec 다음 실행 예정 시간 (CLOCK_MONOTONIC, getMonotonicUSec() 기준) (Thread 전용, 0: 바로 실행)
+ */
+typedef struct _PeriodicTask {
+    int (*loop)(void *);  // 실행할 함수
+    void *args;  // loop 함수에 전달할 인자
+    uint64_t interval;  // 실행 간격 [단위: μs]
+    uint8_t mode;  // 다음 실행 시간 기준
+    ThreadSchedStats stats;  // 실행 시간 통계
+    uint64_t nextRunUSec;  // 다음 실행 예정 시간
+} PeriodicTask;
 
 /**
- * @struct _DirListenerArgs
+ * @struct _ThreadArgs
  *
  * @var _ThreadArgs::statusFlags 상태 Flag
  * @var _ThreadArgs::statusMutex Flag 및 재개 알림 보호 Mutex
- * @var _ThreadArgs::condResumeThread 쓰레드 재개 필요 알림 Condition Variable
+ * @var _ThreadArgs::condResumeThread 쓰레드 재개 필요 알림 Condition Variable (CLOCK_MONOTONIC 기준: initThreadArgs())
+ * @var _ThreadArgs::mainTask startThread()로 시작한 Thread의 작업
+ * @var _ThreadArgs::tasks Thread가 실행하는 작업들 (startThread(): &mainTask)
+ * @var _ThreadArgs::taskCnt 작업 수
+ * @var _ThreadArgs::lockWaits Mutex 획득 대기한 횟수 (Atomic 접근)
+ * @var _ThreadArgs::lockWaitUSec Mutex 획득 대기 시간 합계 [단위: μs] (Atomic 접근)
+ * @var _ThreadArgs::maxLockWaitUSec 최대 Mutex 획득 대기 시간 [단위: μs] (Atomic 접근)
  */
 typedef struct _ThreadArgs {
     uint16_t statusFlags;  // 상태 Flag
     pthread_mutex_t statusMutex;  // Flag 및 재개 알림 보호 Mutex
     pthread_cond_t resumeThread;  // 쓰레드 재개 필요 알림 Condition Variable
+    PeriodicTask mainTask;  // startThread()로 시작한 Thread의 작업
+    PeriodicTask *tasks;  // Thread가 실행하는 작업들
+    size_t taskCnt;  // 작업 수
+    // Mutex 대기 통계 (Thread 자신만 증가, 다른 Thread는 읽기만)
+    uint64_t lockWaits;  // Mutex 획득 대기한 횟수
+    uint64_t lockWaitUSec;  // Mutex 획득 대기 시간 합계
+    uint64_t maxLockWaitUSec;  // 최대 Mutex 획득 대기 시간
 } ThreadArgs;
 
 
+/**
+ * ThreadArgs의 Mutex, Condition Variable 초기화 (Thread 시작 전 1회 호출)
+ *
+ * @param threadArgs 초기화할 ThreadArgs 구조체
+ * @return 성공: 0, 실패: (오류 코드: pthread_cond_init 참조)
+ *
+ * @details
+ * - Condition Variable: CLOCK_MONOTONIC 기준으로 대기 (시스템 시간 변경에 영향 받지 않음)
+ */
+int initThreadArgs(ThreadArgs *threadArgs);
+
+
 /**
  * 새 Thread 시작
  *`
@@ -36,6 +142,10 @@ typedef struct _ThreadArgs {
  * @param threadArgs 새 Thread의 공유 변수
  * @param targetFuncArgs 'onInit', 'loop', 'onFinish' 3개의 각 함수에 전달할 인자 (참고: 구조체 형태로 전달)
  * @return 성공: 0, 실패: (오류 코드: pthread_create 참조)
+ *
+ * @details
+ * - 작업 1개 (threadArgs->mainTask)로 startTaskThread() 호출
+ * - 다음 실행 시간 기준: threadArgs->mainTask.mode (기본: THREAD_SCHED_FIXED_RATE, 시작 전에 변경 가능)
  */
 int startThread(
     pthread_t *newThread,
@@ -47,6 +157,32 @@ int startThread(
     void *targetFuncArgs
 );
 
+/**
+ * 여러 주기 작업을 실행하는 새 Thread 시작
+ *
+ * @param newThread (반환) 새 쓰레드
+ * @param onInit Thread의 Main Loop 진입 직전 실행될 함수 (NULL = 호출할 함수 없음)
+ * @param onFinish Thread의 Main Loop 종료 직후 실행될 함수 (NULL = 호출할 함수 없음)
+ * @param tasks 실행할 작업들 (loop, args, interval, mode 채운 상태) (주의: Thread 종료 시까지 유지되어야 함)
+ * @param taskCnt 작업 수
+ * @param threadArgs 새 Thread의 공유 변수
+ * @param targetFuncArgs 'onInit', 'onFinish' 함수에 전달할 인자
+ * @return 성공: 0, 실패: (오류 코드: pthread_create 참조)
+ *
+ * @details
+ * - 예정 시간 된 작업들을 순서대로 실행 -> 가장 빠른 예정 시간까지 대기
+ * - 재개 요청 (resumeThread() 등): 모든 작업 바로 실행
+ */
+int startTaskThread(
+    pthread_t *newThread,
+    int (*onInit)(void *),
+    int (*onFinish)(void *),
+    PeriodicTask *tasks,
+    size_t taskCnt,
+    ThreadArgs *threadArgs,
+    void *targetFuncArgs
+);
+
 /**
  * Thread 정지 요쳥 (주의: 즉시 정지되지 않으며, iteration 끝난 후 정지됨)
  *
@@ -68,4 +204,55 @@ int pauseThread(ThreadArgs *args);
  */
 int resumeThread(ThreadArgs *args);
 
+/**
+ * Mutex 획득 (대기한 경우: 호출한 Thread의 Mutex 대기 통계에 기록)
+ *
+ * @param mutex 획득할 Mutex
+ * @return 성공: 0, 실패: (오류 코드: pthread_mutex_lock 참조)
+ *
+ * @details
+ * - 바로 획득 가능: pthread_mutex_trylock() 1회 (시간 측정 X)
+ * - startThread() 등으로 시작한 Thread가 아님 (Main Thread 등): 기록 없이 획득만
+ */
+int lockMutex(pthread_mutex_t *mutex);
+
+/**
+ * Thread의 통계 복사
+ *
+ * @param threadArgs 대상 Thread의 ThreadArgs 구조체
+ * @param stats (반환) 통계 (작업 여러 개: 합계)
+ */
+void getThreadStats(ThreadArgs *threadArgs, ThreadStats *stats);
+
+/**
+ * 실행 시간 백분위수 (Histogram 기준 근사값: 해당 구간의 상한)
+ *
+ * @param stats 실행 시간 통계
+ * @param percentile 백분위 ( (0, 100] )
+ * @return 실행 시간 [단위: μs] (실행 기록 없음: 0)
+ */
+uint64_t getRunTimePercentile(const ThreadSchedStats *stats, unsigned int percentile);
+
+/**
+ * 화면 갱신 알림용 eventfd 생성 (Thread들 시작 전 1회 호출)
+ *
+ * @return 성공: 알림 수신용 file descriptor (poll()에 사용), 실패: -1
+ */
+int initUiNotifier(void);
+
+/**
+ * 화면 갱신 필요 알림 (새 결과 게시한 Thread에서 호출)
+ * 여러 번 알려도 하나로 합쳐짐 (eventfd)
+ *
+ * @param source 알림 종류 (UI_WAKE_DATA or UI_WAKE_PROGRESS): 종류에 따라 화면 갱신 빈도 달라짐
+ */
+void notifyUi(uint32_t source);
+
+/**
+ * 쌓인 화면 갱신 알림 비움 (Main Thread에서, 알림 수신 후 호출)
+ *
+ * @return 마지막 호출 이후 알림된 종류들 (UI_WAKE_* bitmask)
+ */
+uint32_t clearUiNotification(void);
+
 #endif
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <curses.h>
 #include <panel.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,9 +17,15 @@
 static WINDOW *titleBar;  // 제목 Bar Window
 static PANEL *titlePanel;
 
+static char shownPath[PATH_MAX];  // 마지막으로 출력한 경로
+static size_t shownPathLen;
+static int shownWidth = -1;  // 마지막으로 출력한 화면 폭 (-1: 출력한 적 없음)
+static bool isTimeShown;  // 현재 배치에 시간 포함 여부
+static time_t shownSec = -1;  // 마지막으로 출력한 시간 (초)
+
 
 /**
- * 화면 우상단에 현재 시간 표시 (또는 새로고침)
+ * 화면 우상단에 현재 시간 표시 (또는 새로고침): 마지막으로 출력한 시간과 초가 같으면 건너뜀
  */
 static void renderTime(int barWidth);
 
@@ -51,6 +58,9 @@ void renderTime(int barWidth) {
         perror("Time");
         exit(-1);
     }
+    if (now.tv_sec == shownSec)  // 같은 초: 다시 그릴 필요 X
+        return;
+    shownSec = now.tv_sec;
     struct tm *dt = localtime(&now.tv_sec);  // 가져온 시간을 구조체로 변환
     DT_TO_STR(buf, dt);  // 날짜 및 시간 Formatting
     mvwaddstr(titleBar, 0, barWidth - DATETIME_LEN, buf);  // 출력
@@ -63,19 +73,33 @@ void printPath(const char *path, size_t pathLen, int barWidth) {
 }
 
 void updateTitleBar(const char *cwd, size_t cwdLen) {
-    werase(titleBar);  // 기존 내용을 지움
     int screenWidth = getmaxx(stdscr);
+    if (screenWidth == shownWidth && cwdLen == shownPathLen && memcmp(cwd, shownPath, cwdLen) == 0) {
+        // 경로, 폭 그대로: 시간만 갱신
+        if (isTimeShown)
+            renderTime(screenWidth);
+        return;
+    }
+    memcpy(shownPath, cwd, cwdLen);
+    shownPathLen = cwdLen;
+    shownWidth = screenWidth;
+    shownSec = -1;  // 지운 뒤 시간 다시 출력
+
+    werase(titleBar);  // 기존 내용을 지움
     int longerLen = PROG_NAME_LEN > DATETIME_LEN ? PROG_NAME_LEN : DATETIME_LEN;
 
     if (screenWidth >= cwdLen + longerLen * 2 + 2) {  // 프로그램 이름 + 경로 + 시간
         CHECK_CURSES(mvwaddstr(titleBar, 0, 0, PROG_NAME));  // 프로그램 이름 (왼쪽)
         printPath(cwd, cwdLen, screenWidth);  // 현재 경로 (가운데)
         renderTime(screenWidth);  // 시간 (오른쪽)
+        isTimeShown = true;
     } else if (screenWidth >= cwdLen + DATETIME_LEN + 1) {  // 경로 + 시간
         mvwaddnstr(titleBar, 0, 0, cwd, cwdLen);  // 현재 경로 (왼쪽)
         renderTime(screenWidth);  // 오른쪽 끝에 시간 출력
+        isTimeShown = true;
     } else {  // 경로만
         mvwaddnstr(titleBar, 0, 0, cwd, cwdLen);  // 현재 경로
+        isTimeShown = false;
     }
     mvwhline(titleBar, 1, 0, ACS_HLINE, getmaxx(stdscr));
 }
@@ -21,6 +21,10 @@ void delTitleBar(void);
  * @brief 제목 표시줄의 내용을 갱신
  *
  * @param cwd 현재 작업 디렉토리 경로
+ * @param cwdLen 경로 길이 (최대 PATH_MAX)
+ *
+ * @details
+ * - 경로, 화면 폭이 마지막 출력과 같으면: 시간만 (초 바뀐 경우) 다시 그림
  */
 void updateTitleBar(const char *cwd, size_t cwdLen);
 
@@ -0,0 +1,174 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "trace.h"
+
+#define TRACE_MAX_THREADS 64  // 추적 가능한 최대 Thread 수 (초과: 해당 Thread는 기록 X)
+
+
+/**
+ * @struct _TraceEvent
+ * 끝난 구간 1개
+ *
+ * @var _TraceEvent::name 구간 이름
+ * @var _TraceEvent::startUSec 시작 시간
+ * @var _TraceEvent::durUSec 걸린 시간
+ */
+typedef struct _TraceEvent {
+    const char *name;  // 구간 이름
+    uint64_t startUSec;  // 시작 시간
+    uint64_t durUSec;  // 걸린 시간
+} TraceEvent;
+
+/**
+ * @struct _TraceBuffer
+ * Thread 1개의 Ring Buffer (해당 Thread만 기록)
+ *
+ * @var _TraceBuffer::tid Thread ID (gettid())
+ * @var _TraceBuffer::name 표시 이름 (NULL: 없음)
+ * @var _TraceBuffer::written 지금까지 기록한 구간 수 (Atomic 접근: 저장 시 읽음)
+ * @var _TraceBuffer::events 구간들 (written % TRACE_BUFFER_EVENTS 위치에 기록)
+ */
+typedef struct _TraceBuffer {
+    pid_t tid;  // Thread ID
+    const char *name;  // 표시 이름
+    uint64_t written;  // 지금까지 기록한 구간 수
+    TraceEvent events[TRACE_BUFFER_EVENTS];  // 구간들
+} TraceBuffer;
+
+
+bool isTraceEnabled;
+
+static char *tracePath;  // 저장할 파일 경로
+static TraceBuffer *buffers[TRACE_MAX_THREADS];  // 각 Thread의 Buffer
+static unsigned int bufferCnt;  // 할당한 Buffer 수 (Atomic 접근)
+static __thread TraceBuffer *threadBuffer;  // 현재 Thread의 Buffer (NULL: 아직 없음)
+static __thread bool isBufferUnavailable;  // Buffer 할당 실패 (이후 기록 X)
+
+
+/**
+ * 현재 Thread의 Buffer 가져옴 (처음: 할당 후 등록)
+ *
+ * @return Buffer, 실패: NULL
+ */
+static TraceBuffer *getThreadBuffer(void);
+
+/**
+ * JSON 문자열로 출력 (따옴표, '\', 제어 문자 Escape)
+ *
+ * @param file 출력할 파일
+ * @param str 출력할 문자열
+ */
+static void writeJsonString(FILE *file, const char *str);
+
+
+void initTrace(const char *path) {
+    if (path == NULL || path[0] == '\0')
+        return;
+    tracePath = strdup(path);
+    if (tracePath == NULL)
+        return;
+    isTraceEnabled = true;
+}
+
+TraceBuffer *getThreadBuffer(void) {
+    if (threadBuffer != NULL || isBufferUnavailable)
+        return threadBuffer;
+
+    unsigned int slot = __atomic_fetch_add(&bufferCnt, 1, __ATOMIC_RELAXED);
+    TraceBuffer *buffer = slot < TRACE_MAX_THREADS ? calloc(1, sizeof(TraceBuffer)) : NULL;
+    if (buffer == NULL) {  // 자리 없음 or 할당 실패: 빈 칸으로 남음
+        isBufferUnavailable = true;
+        return NULL;
+    }
+    buffer->tid = gettid();
+    __atomic_store_n(&buffers[slot], buffer, __ATOMIC_RELEASE);
+    threadBuffer = buffer;
+    return buffer;
+}
+
+void traceThreadName(const char *name) {
+    if (!isTraceEnabled)
+        return;
+    TraceBuffer *buffer = getThreadBuffer();
+    if (buffer != NULL)
+        buffer->name = name;
+}
+
+void traceComplete(const char *name, uint64_t startUSec) {
+    TraceBuffer *buffer = getThreadBuffer();
+    if (buffer == NULL)
+        return;
+
+    uint64_t written = buffer->written;  // 기록은 이 Thread만 -> 그냥 읽어도 됨
+    TraceEvent *event = &buffer->events[written % TRACE_BUFFER_EVENTS];
+    event->name = name;
+    event->startUSec = startUSec;
+    event->durUSec = getMonotonicUSec() - startUSec;
+    __atomic_store_n(&buffer->written, written + 1, __ATOMIC_RELEASE);  // 구간 내용 기록 후 개수 증가
+}
+
+int flushTrace(void) {
+    if (!isTraceEnabled)
+        return -1;
+
+    FILE *file = fopen(tracePath, "w");
+    if (file == NULL)
+        return -1;
+
+    pid_t pid = getpid();
+    bool isFirst = true;
+    unsigned int cnt = __atomic_load_n(&bufferCnt, __ATOMIC_RELAXED);
+    if (cnt > TRACE_MAX_THREADS)
+        cnt = TRACE_MAX_THREADS;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (unsigned int i = 0; i < cnt; i++) {
+        TraceBuffer *buffer = __atomic_load_n(&buffers[i], __ATOMIC_ACQUIRE);
+        if (buffer == NULL)  // 할당 실패 or 아직 등록 중
+            continue;
+
+        // Thread 이름 (Metadata Event)
+        if (buffer->name != NULL) {
+            fprintf(file, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":", isFirst ? "" : ",\n", pid, buffer->tid);
+            writeJsonString(file, buffer->name);
+            fprintf(file, "}}");
+            isFirst = false;
+        }
+
+        // 구간들: 가득 찼으면 가장 오래된 것부터 (멈춘 Thread가 아직 기록 중일 수 있음: 덮어쓰인 구간이 섞일 수 있으나 무시)
+        uint64_t written = __atomic_load_n(&buffer->written, __ATOMIC_ACQUIRE);
+        uint64_t first = written > TRACE_BUFFER_EVENTS ? written - TRACE_BUFFER_EVENTS : 0;
+        for (uint64_t j = first; j < written; j++) {
+            const TraceEvent *event = &buffer->events[j % TRACE_BUFFER_EVENTS];
+            fprintf(file, "%s{\"ph\":\"X\",\"name\":", isFirst ? "" : ",\n");
+            writeJsonString(file, event->name);
+            fprintf(
+                file, ",\"pid\":%d,\"tid\":%d,\"ts\":%llu,\"dur\":%llu}",
+                pid, buffer->tid, (unsigned long long)event->startUSec, (unsigned long long)event->durUSec
+            );
+            isFirst = false;
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+void writeJsonString(FILE *file, const char *str) {
+    fputc('"', file);
+    for (; *str != '\0'; str++) {
+        if (*str == '"' || *str == '\\')
+            fprintf(file, "\\%c", *str);
+        else if ((unsigned char)*str < 0x20)
+            fprintf(file, "\\u%04x", (unsigned char)*str);
+        else
+            fputc(*str, file);
+    }
+    fputc('"', file);
+}
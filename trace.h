@@ -0,0 +1,58 @@
+#ifndef _TRACE_H_INCLUDED_
+#define _TRACE_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "commons.h"
+
+
+// 구간 시작: 시작 시간 저장할 변수 선언 (추적 꺼짐: 분기 1회)
+#define TRACE_BEGIN(startVar) uint64_t startVar = __builtin_expect(isTraceEnabled, 0) ? getMonotonicUSec() : 0
+// 구간 끝: 시작 시간 ~ 현재까지를 이름 붙여 기록 (추적 꺼짐: 분기 1회)
+#define TRACE_END(startVar, name) do { \
+    if (__builtin_expect(isTraceEnabled, 0)) \
+        traceComplete((name), (startVar)); \
+} while (0)
+
+
+extern bool isTraceEnabled;  // 추적 사용 여부 (initTrace() 이후 변경 X)
+
+
+/**
+ * 추적 시작 (Thread들 시작 전 1회 호출)
+ *
+ * @param path 종료 시 Trace를 저장할 파일 경로 (NULL: 추적 X)
+ *
+ * @details
+ * - Thread마다 고정 크기 Ring Buffer (`TRACE_BUFFER_EVENTS`개) 사용: 가득 차면 오래된 구간부터 덮어씀
+ * - 기록 시 Lock 없음 (Buffer는 해당 Thread만 기록)
+ */
+void initTrace(const char *path);
+
+/**
+ * 현재 Thread의 Trace 표시 이름 설정 (추적 꺼짐: 무시)
+ *
+ * @param name 표시 이름 (주의: 프로그램 종료 시까지 유지되는 문자열)
+ */
+void traceThreadName(const char *name);
+
+/**
+ * 끝난 구간 1개 기록 (TRACE_END 사용)
+ *
+ * @param name 구간 이름 (주의: 프로그램 종료 시까지 유지되는 문자열)
+ * @param startUSec 구간 시작 시간 (getMonotonicUSec() 기준)
+ */
+void traceComplete(const char *name, uint64_t startUSec);
+
+/**
+ * 기록된 구간들을 Chrome Trace (JSON) 형식으로 저장 (Thread들 정지 후 호출)
+ *
+ * @return 성공: 0, 추적 꺼짐 or 실패: -1
+ *
+ * @details
+ * - chrome://tracing, Perfetto (ui.perfetto.dev)에서 열 수 있음
+ */
+int flushTrace(void);
+
+#endif
@@ -0,0 +1,490 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "uring_copy.h"
+
+_Static_assert(URING_ENTRIES >= URING_COPY_DEPTH * 4, "URING_ENTRIES must hold 4 SQEs (open, create, read, write) per batched file");
+
+#ifdef USE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+
+/**
+ * @struct _Uring
+ * Thread 1개의 io_uring (liburing 없이 직접 mmap)
+ *
+ * @var _Uring::fd io_uring descriptor
+ * @var _Uring::ringMem SQ, CQ Ring (IORING_FEAT_SINGLE_MMAP: 한 번에 mmap)
+ * @var _Uring::ringMemSize ringMem 크기
+ * @var _Uring::sqes SQE 배열
+ * @var _Uring::sqesSize sqes 크기
+ * @var _Uring::sqTail SQ Tail (제출 시 갱신)
+ * @var _Uring::sqMask SQ Index Mask
+ * @var _Uring::sqArray SQ Index 배열
+ * @var _Uring::cqHead CQ Head (결과 가져간 후 갱신)
+ * @var _Uring::cqTail CQ Tail (Kernel이 갱신)
+ * @var _Uring::cqMask CQ Index Mask
+ * @var _Uring::cqes CQE 배열
+ * @var _Uring::queued 채웠지만 아직 제출하지 않은 SQE 수
+ * @var _Uring::bufs 복사용 Buffer들 (`URING_COPY_DEPTH` x `URING_BUF_SIZE`, Page 단위 정렬)
+ * @var _Uring::isFixedBufs Buffer 등록됨 (READ_FIXED, WRITE_FIXED 사용)
+ * @var _Uring::isFixedFiles 파일 자리 등록됨 + 파일 자리로 바로 열기 지원 (`URING_COPY_DEPTH` x 2개, 작은 파일 묶음 복사 가능)
+ */
+typedef struct _Uring {
+    int fd;  // io_uring descriptor
+    void *ringMem;  // SQ, CQ Ring
+    size_t ringMemSize;  // ringMem 크기
+    struct io_uring_sqe *sqes;  // SQE 배열
+    size_t sqesSize;  // sqes 크기
+    unsigned int *sqTail;  // SQ Tail
+    unsigned int *sqMask;  // SQ Index Mask
+    unsigned int *sqArray;  // SQ Index 배열
+    unsigned int *cqHead;  // CQ Head
+    unsigned int *cqTail;  // CQ Tail
+    unsigned int *cqMask;  // CQ Index Mask
+    struct io_uring_cqe *cqes;  // CQE 배열
+    unsigned int queued;  // 아직 제출하지 않은 SQE 수
+    char *bufs;  // 복사용 Buffer들
+    bool isFixedBufs;  // Buffer 등록됨
+    bool isFixedFiles;  // 파일 자리 등록됨
+} Uring;
+
+
+static __thread Uring *threadUring;  // 현재 Thread의 io_uring (NULL: 아직 없음)
+static __thread bool isUringUnavailable;  // 생성 실패 (이후 다시 시도 X)
+
+
+/**
+ * 현재 Thread의 io_uring 가져옴 (처음: 생성, Buffer와 파일 자리 등록)
+ *
+ * @return io_uring, 사용 불가: NULL (errno: ENOSYS 등)
+ */
+static Uring *getThreadUring(void);
+
+/**
+ * 등록된 파일 자리로 바로 여는 OPENAT (file_index) 지원 확인 (Kernel 5.15 이상)
+ *
+ * @param ring io_uring (파일 자리 등록됨, 아직 채운 SQE 없음)
+ * @return 지원: true, 미지원: false
+ *
+ * @details
+ * - 오래된 Kernel: file_index 무시하고 일반 fd 반환 -> 그 fd 닫고 미지원으로 처리
+ * - 지원: 확인용으로 연 자리는 IORING_OP_CLOSE로 닫음
+ */
+static bool probeDirectOpen(Uring *ring);
+
+/**
+ * io_uring 해제 (mmap 해제, Buffer 해제, descriptor close)
+ *
+ * @param ring 해제할 io_uring
+ */
+static void freeUring(Uring *ring);
+
+/**
+ * 다음 SQE 가져옴 (0으로 초기화, user_data: 이번 제출에서의 순서)
+ *
+ * @param ring io_uring
+ * @return SQE
+ *
+ * @details
+ * - runUring()이 매번 모두 제출 -> 한 번에 채우는 SQE 수가 `URING_ENTRIES` 이하면 항상 자리 있음
+ */
+static struct io_uring_sqe *getSqe(Uring *ring);
+
+/**
+ * 채운 SQE 모두 제출 후 모든 결과 대기
+ *
+ * @param ring io_uring
+ * @param results (반환) SQE 순서대로의 결과 (CQE의 res: 실패 시 -errno)
+ * @return 성공: 0, 제출 실패: -1 (results 사용 X)
+ *
+ * @details
+ * - 일부만 제출된 후 실패: 나머지는 -ECANCELED로 기록하고 제출된 것의 결과만 대기
+ */
+static int runUring(Uring *ring, int *results);
+
+
+Uring *getThreadUring(void) {
+    if (threadUring != NULL || isUringUnavailable) {
+        if (threadUring == NULL)
+            errno = ENOSYS;
+        return threadUring;
+    }
+    isUringUnavailable = true;  // 아래에서 실패: 다시 시도 X
+
+    Uring *ring = calloc(1, sizeof(Uring));
+    if (ring == NULL)
+        return NULL;
+    ring->fd = -1;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring->fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &params);
+    if (ring->fd == -1 || !(params.features & IORING_FEAT_SINGLE_MMAP)) {  // Kernel 지원 X (5.4 미만) or 금지됨 (io_uring_disabled, seccomp)
+        freeUring(ring);
+        errno = ENOSYS;
+        return NULL;
+    }
+
+    // SQ, CQ Ring: 한 번에 mmap
+    size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->ringMemSize = sqSize > cqSize ? sqSize : cqSize;
+    ring->ringMem = mmap(NULL, ring->ringMemSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->ringMem == MAP_FAILED) {
+        ring->ringMem = NULL;
+        freeUring(ring);
+        return NULL;
+    }
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        freeUring(ring);
+        return NULL;
+    }
+    char *mem = ring->ringMem;
+    ring->sqTail = (unsigned int *)(mem + params.sq_off.tail);
+    ring->sqMask = (unsigned int *)(mem + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned int *)(mem + params.sq_off.array);
+    ring->cqHead = (unsigned int *)(mem + params.cq_off.head);
+    ring->cqTail = (unsigned int *)(mem + params.cq_off.tail);
+    ring->cqMask = (unsigned int *)(mem + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(mem + params.cq_off.cqes);
+
+    // 복사용 Buffer: 등록 실패 (RLIMIT_MEMLOCK 초과 등)해도 일반 Buffer로 사용
+    void *bufs;
+    if (posix_memalign(&bufs, sysconf(_SC_PAGESIZE), URING_COPY_DEPTH * URING_BUF_SIZE) != 0) {
+        freeUring(ring);
+        return NULL;
+    }
+    ring->bufs = bufs;
+    struct iovec iovs[URING_COPY_DEPTH];
+    for (size_t i = 0; i < URING_COPY_DEPTH; i++) {
+        iovs[i].iov_base = ring->bufs + i * URING_BUF_SIZE;
+        iovs[i].iov_len = URING_BUF_SIZE;
+    }
+    ring->isFixedBufs = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, iovs, URING_COPY_DEPTH) == 0;
+
+    // 파일 자리 (비어 있음: -1): 작은 파일 묶음 복사에서 열린 파일 보관 (파일마다 원본, 대상 2개)
+    int fds[URING_COPY_DEPTH * 2];
+    for (size_t i = 0; i < URING_COPY_DEPTH * 2; i++)
+        fds[i] = -1;
+    ring->isFixedFiles = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_FILES, fds, URING_COPY_DEPTH * 2) == 0
+                         && probeDirectOpen(ring);
+
+    isUringUnavailable = false;
+    threadUring = ring;
+    return ring;
+}
+
+bool probeDirectOpen(Uring *ring) {
+    int results[1] = { 0 };
+
+    struct io_uring_sqe *sqe = getSqe(ring);
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uintptr_t)"/";
+    sqe->open_flags = O_RDONLY | O_DIRECTORY;
+    sqe->file_index = 1;  // 첫 번째 자리
+    if (runUring(ring, results) == -1)
+        return false;
+    if (results[0] > 0)  // file_index 무시됨: 일반 fd로 열림
+        close(results[0]);
+    if (results[0] != 0)
+        return false;
+
+    sqe = getSqe(ring);
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->file_index = 1;
+    return runUring(ring, results) == 0 && results[0] == 0;
+}
+
+void freeUring(Uring *ring) {
+    if (ring->sqes != NULL)
+        munmap(ring->sqes, ring->sqesSize);
+    if (ring->ringMem != NULL)
+        munmap(ring->ringMem, ring->ringMemSize);
+    if (ring->fd != -1)
+        close(ring->fd);  // 등록된 Buffer, 파일 자리: 같이 해제됨
+    free(ring->bufs);
+    free(ring);
+}
+
+struct io_uring_sqe *getSqe(Uring *ring) {
+    unsigned int tail = *ring->sqTail + ring->queued;  // Tail: 이 Thread만 갱신
+    unsigned int idx = tail & *ring->sqMask;
+    struct io_uring_sqe *sqe = &ring->sqes[idx];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->user_data = ring->queued;
+    ring->sqArray[idx] = idx;
+    ring->queued++;
+    return sqe;
+}
+
+int runUring(Uring *ring, int *results) {
+    unsigned int total = ring->queued;
+    unsigned int toSubmit = total;
+    unsigned int reaped = 0;
+
+    // SQE 내용 기록 후 Tail 갱신 (Kernel이 Tail까지 읽음)
+    __atomic_store_n(ring->sqTail, *ring->sqTail + total, __ATOMIC_RELEASE);
+    ring->queued = 0;
+
+    while (reaped < total) {
+        // 나온 결과 모두 가져옴
+        unsigned int head = *ring->cqHead;
+        unsigned int tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++) {
+            struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cqMask];
+            if (cqe->user_data < total)
+                results[cqe->user_data] = cqe->res;
+            reaped++;
+        }
+        __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+        if (reaped >= total && toSubmit == 0)
+            break;
+
+        // 제출 (남은 것 있으면) + 남은 결과 모두 대기
+        int ret = syscall(__NR_io_uring_enter, ring->fd, toSubmit, total - reaped, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret == -1) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                continue;
+            // 제출 못한 SQE (뒤쪽): 되돌리고 취소된 것으로 기록, 이미 제출된 것은 끝날 때까지 대기 (Buffer 사용 중)
+            __atomic_store_n(ring->sqTail, *ring->sqTail - toSubmit, __ATOMIC_RELEASE);
+            for (unsigned int i = total - toSubmit; i < total; i++)
+                results[i] = -ECANCELED;
+            total -= toSubmit;
+            toSubmit = 0;
+            if (total == 0)
+                return -1;
+            continue;
+        }
+        toSubmit -= (unsigned int)ret < toSubmit ? (unsigned int)ret : toSubmit;
+    }
+    return 0;
+}
+
+void closeUringCopy(void) {
+    if (threadUring == NULL)
+        return;
+    freeUring(threadUring);
+    threadUring = NULL;
+}
+
+int copyFilesUring(UringFileCopy *files, size_t cnt) {
+    Uring *ring = getThreadUring();
+    if (ring == NULL)
+        return -1;
+    if (!ring->isFixedFiles) {
+        errno = ENOSYS;
+        return -1;
+    }
+    if (cnt > URING_COPY_DEPTH)
+        cnt = URING_COPY_DEPTH;
+
+    int results[URING_ENTRIES] = { 0 };
+    unsigned int firstSqe[URING_COPY_DEPTH];  // 파일별 첫 SQE 순서 (원본 열기, 대상 만들기, 읽기, 쓰기)
+
+    // 1. 파일마다: 원본 열기 -> 대상 만들기 -> 읽기 -> 쓰기 (앞 단계 실패 or 짧게 끝남: 뒤 단계 취소됨)
+    for (size_t i = 0; i < cnt; i++) {
+        unsigned int srcSlot = i * 2, dstSlot = i * 2 + 1;
+        char *buf = ring->bufs + i * URING_BUF_SIZE;
+        bool hasData = files[i].fileSize > 0;
+        firstSqe[i] = ring->queued;
+
+        struct io_uring_sqe *sqe = getSqe(ring);
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = files[i].srcDirFd;
+        sqe->addr = (uintptr_t)files[i].name;
+        sqe->open_flags = O_RDONLY;
+        sqe->file_index = srcSlot + 1;  // 1부터: 0은 일반 fd 반환
+        sqe->flags = IOSQE_IO_LINK;
+
+        sqe = getSqe(ring);
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = files[i].dstDirFd;
+        sqe->addr = (uintptr_t)files[i].name;
+        sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC;
+        sqe->len = 0644;  // 만들 파일 권한
+        sqe->file_index = dstSlot + 1;
+        sqe->flags = hasData ? IOSQE_IO_LINK : 0;
+        if (!hasData)  // 빈 파일: 만들기만
+            continue;
+
+        sqe = getSqe(ring);
+        sqe->opcode = ring->isFixedBufs ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->fd = srcSlot;
+        sqe->addr = (uintptr_t)buf;
+        sqe->len = files[i].fileSize;
+        sqe->off = 0;
+        sqe->buf_index = i;
+        sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_LINK;
+
+        sqe = getSqe(ring);
+        sqe->opcode = ring->isFixedBufs ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe->fd = dstSlot;
+        sqe->addr = (uintptr_t)buf;
+        sqe->len = files[i].fileSize;
+        sqe->off = 0;
+        sqe->buf_index = i;
+        sqe->flags = IOSQE_FIXED_FILE;
+    }
+    unsigned int stepCnt = ring->queued;
+    if (runUring(ring, results) == -1)
+        return -1;
+
+    // 파일별 결과: 첫 실패 단계의 오류 (읽기, 쓰기: 요청보다 짧으면 실패)
+    for (size_t i = 0; i < cnt; i++) {
+        unsigned int first = firstSqe[i];
+        unsigned int last = i + 1 < cnt ? firstSqe[i + 1] : stepCnt;
+        files[i].result = 0;
+        files[i].error = 0;
+        for (unsigned int step = first; step < last; step++) {
+            int res = results[step];
+            bool isFailed = step - first < 2 ? res != 0 : res != (int)files[i].fileSize;  // 열기: 파일 자리에 열려야 0
+            if (isFailed) {
+                files[i].result = -1;
+                files[i].error = res < 0 ? -res : EIO;
+                break;
+            }
+        }
+    }
+
+    // 2. 열린 파일 모두 닫음 (대상: 닫기 실패도 쓰기 실패로 취급)
+    unsigned int closeFile[URING_COPY_DEPTH * 2];
+    unsigned int closeCnt = 0;
+    for (size_t i = 0; i < cnt; i++) {
+        for (unsigned int side = 0; side < 2; side++) {
+            if (results[firstSqe[i] + side] != 0)  // 파일 자리에 열지 못함 (취소됨 포함)
+                continue;
+            struct io_uring_sqe *sqe = getSqe(ring);
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->file_index = i * 2 + side + 1;
+            closeFile[closeCnt++] = i * 2 + side;
+        }
+    }
+    if (closeCnt == 0)
+        return 0;
+    if (runUring(ring, results) == -1) {  // 닫지 못함: 다음 묶음이 같은 자리에 열 때 교체됨
+        for (size_t i = 0; i < cnt; i++) {
+            if (files[i].result == 0) {
+                files[i].result = -1;
+                files[i].error = errno;
+            }
+        }
+        return 0;
+    }
+    for (unsigned int i = 0; i < closeCnt; i++) {
+        UringFileCopy *file = &files[closeFile[i] / 2];
+        if (results[i] < 0 && (closeFile[i] % 2) == 1 && file->result == 0) {
+            file->result = -1;
+            file->error = -results[i];
+        }
+    }
+    return 0;
+}
+
+int statFilesUring(int dirFd, const char *const *names, struct statx *stats, int *errors, size_t cnt) {
+    Uring *ring = getThreadUring();
+    if (ring == NULL)
+        return -1;
+    if (cnt > URING_ENTRIES)
+        cnt = URING_ENTRIES;
+
+    int results[URING_ENTRIES] = { 0 };
+    for (size_t i = 0; i < cnt; i++) {
+        struct io_uring_sqe *sqe = getSqe(ring);
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = dirFd;
+        sqe->addr = (uintptr_t)names[i];
+        sqe->statx_flags = AT_SYMLINK_NOFOLLOW;
+        sqe->len = STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_BLOCKS;
+        sqe->addr2 = (uintptr_t)&stats[i];
+    }
+    if (runUring(ring, results) == -1)
+        return -1;
+    for (size_t i = 0; i < cnt; i++)
+        errors[i] = results[i] < 0 ? -results[i] : 0;
+    return 0;
+}
+
+ssize_t copyRangeUring(int srcFd, int dstFd, off_t pos, off_t end) {
+    Uring *ring = getThreadUring();
+    if (ring == NULL)
+        return -1;
+
+    int results[URING_ENTRIES] = { 0 };
+    size_t lens[URING_COPY_DEPTH];
+    size_t chunkCnt = 0;
+
+    // Chunk마다: 읽기 -> 쓰기 (읽기 실패 or 짧게 끝남: 쓰기 취소됨)
+    for (off_t off = pos; off < end && chunkCnt < URING_COPY_DEPTH; off += URING_BUF_SIZE, chunkCnt++) {
+        char *buf = ring->bufs + chunkCnt * URING_BUF_SIZE;
+        lens[chunkCnt] = end - off < URING_BUF_SIZE ? end - off : URING_BUF_SIZE;
+
+        struct io_uring_sqe *sqe = getSqe(ring);
+        sqe->opcode = ring->isFixedBufs ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->fd = srcFd;
+        sqe->addr = (uintptr_t)buf;
+        sqe->len = lens[chunkCnt];
+        sqe->off = off;
+        sqe->buf_index = chunkCnt;
+        sqe->flags = IOSQE_IO_LINK;
+
+        sqe = getSqe(ring);
+        sqe->opcode = ring->isFixedBufs ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe->fd = dstFd;
+        sqe->addr = (uintptr_t)buf;
+        sqe->len = lens[chunkCnt];
+        sqe->off = off;
+        sqe->buf_index = chunkCnt;
+    }
+    if (runUring(ring, results) == -1)
+        return -1;
+
+    // 앞에서부터 이어서 성공한 Chunk까지만 복사된 것으로 취급 (뒤쪽: 다음 호출 or 다음 방식이 다시 씀)
+    ssize_t copied = 0;
+    for (size_t i = 0; i < chunkCnt; i++) {
+        int readRes = results[i * 2], writeRes = results[i * 2 + 1];
+        if (readRes != (int)lens[i] || writeRes != (int)lens[i]) {
+            if (copied == 0) {
+                errno = readRes < 0 ? -readRes : (writeRes < 0 && writeRes != -ECANCELED ? -writeRes : EIO);
+                return -1;
+            }
+            break;
+        }
+        copied += lens[i];
+    }
+    return copied;
+}
+
+#else
+
+void closeUringCopy(void) {
+}
+
+int copyFilesUring(UringFileCopy *files, size_t cnt) {
+    errno = ENOSYS;
+    return -1;
+}
+
+int statFilesUring(int dirFd, const char *const *names, struct statx *stats, int *errors, size_t cnt) {
+    errno = ENOSYS;
+    return -1;
+}
+
+ssize_t copyRangeUring(int srcFd, int dstFd, off_t pos, off_t end) {
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef _URING_COPY_H_INCLUDED_
+#define _URING_COPY_H_INCLUDED_
+
+#include <stddef.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "config.h"
+
+
+/**
+ * @struct _UringFileCopy
+ * io_uring으로 묶어 복사할 작은 파일 1개
+ *
+ * @var _UringFileCopy::srcDirFd 원본이 있는 폴더
+ * @var _UringFileCopy::dstDirFd 대상을 만들 폴더
+ * @var _UringFileCopy::name 이름 (원본, 대상 같음)
+ * @var _UringFileCopy::fileSize 복사할 크기 (`URING_BUF_SIZE` 이하)
+ * @var _UringFileCopy::result 결과 (0: 성공, -1: 실패 -> 대상 파일이 남아 있을 수 있음)
+ * @var _UringFileCopy::error 실패 시 errno
+ */
+typedef struct _UringFileCopy {
+    int srcDirFd;  // 원본이 있는 폴더
+    int dstDirFd;  // 대상을 만들 폴더
+    const char *name;  // 이름
+    size_t fileSize;  // 복사할 크기
+    int result;  // 결과
+    int error;  // 실패 시 errno
+} UringFileCopy;
+
+
+/**
+ * 현재 Thread의 io_uring 해제 (File Operator Thread 종료 시 호출, 없으면: 무시)
+ */
+void closeUringCopy(void);
+
+/**
+ * 작은 파일 여러 개를 한 번에 복사 (파일마다: 원본 열기 -> 대상 만들기 -> 읽기 -> 쓰기 연결, 이후 한 번에 닫기)
+ *
+ * @param files 복사할 파일들 (최대 `URING_COPY_DEPTH`개, 결과: 파일마다 기록)
+ * @param cnt 파일 수
+ * @return 실행함: 0, io_uring 사용 불가: -1 (errno: ENOSYS 등, 아무것도 하지 않음)
+ *
+ * @details
+ * - 열린 파일: 등록된 파일 자리 (Direct Descriptor)에만 있음 -> 프로세스의 fd 사용 X
+ * - 현재 Thread의 io_uring: 처음 호출 시 생성 (Buffer 등록 불가: 일반 Buffer로 읽고 씀)
+ */
+int copyFilesUring(UringFileCopy *files, size_t cnt);
+
+/**
+ * 폴더 안 항목 여러 개의 statx()를 한 번에 실행 (Symbolic Link: 따라가지 않음)
+ *
+ * @param dirFd 항목들이 있는 폴더
+ * @param names 항목 이름들
+ * @param stats (반환) 항목별 결과
+ * @param errors (반환) 항목별 실패 시 errno (0: 성공)
+ * @param cnt 항목 수 (최대 `URING_ENTRIES`개)
+ * @return 실행함: 0, io_uring 사용 불가: -1
+ */
+int statFilesUring(int dirFd, const char *const *names, struct statx *stats, int *errors, size_t cnt);
+
+/**
+ * 큰 파일의 [pos, end) 중 앞부분을 Chunk 여러 개로 나눠 동시에 복사 (Chunk마다 읽기 -> 쓰기 연결)
+ *
+ * @param srcFd 원본 파일 descriptor
+ * @param dstFd 대상 파일 descriptor
+ * @param pos 복사 시작 위치
+ * @param end 복사할 구간의 끝
+ * @return 앞에서부터 이어서 복사된 크기 (최대 `URING_COPY_DEPTH` x `URING_BUF_SIZE`), 실패 or 사용 불가: -1
+ */
+ssize_t copyRangeUring(int srcFd, int dstFd, off_t pos, off_t end);
+
+#endif